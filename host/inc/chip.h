@@ -0,0 +1,584 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef CHIP_H_
+#define CHIP_H_
+
+/** @file chip.h
+ ** @brief Modelo del HAL del LPC43xx para compilar y probar el firmware en la PC
+ **
+ ** Este archivo reemplaza al chip.h de LPCOpen cuando el código se compila para el equipo de desarrollo. Solo declara
+ ** lo que utiliza el firmware, con los mismos nombres y valores que la biblioteca original.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* Modos de configuración de los pines del SCU */
+#define SCU_MODE_PULLUP            (0x0 << 3)
+#define SCU_MODE_REPEATER          (0x1 << 3)
+#define SCU_MODE_INACT             (0x2 << 3)
+#define SCU_MODE_PULLDOWN          (0x3 << 3)
+#define SCU_MODE_HIGHSPEEDSLEW_EN  (0x1 << 5)
+#define SCU_MODE_INBUFF_EN         (0x1 << 6)
+#define SCU_MODE_ZIF_DIS           (0x1 << 7)
+
+/* Funciones alternativas de los pines del SCU */
+#define SCU_MODE_FUNC0 0x0
+#define SCU_MODE_FUNC1 0x1
+#define SCU_MODE_FUNC2 0x2
+#define SCU_MODE_FUNC3 0x3
+#define SCU_MODE_FUNC4 0x4
+#define SCU_MODE_FUNC5 0x5
+#define SCU_MODE_FUNC6 0x6
+#define SCU_MODE_FUNC7 0x7
+
+#define HOST_GPIO_PORTS 8 //!< Cantidad de puertos GPIO del LPC43xx
+
+#define HOST_SCU_PORTS 16 //!< Cantidad de grupos de pines del SCU del LPC43xx
+#define HOST_SCU_PINS  32 //!< Cantidad de pines por grupo del SCU
+
+#ifndef HOST_CORE_SLOWDOWN
+#define HOST_CORE_SLOWDOWN 20 //!< Veces que tarda más el Cortex-M4 a 204 MHz que la PC en el mismo código, estimado
+#endif
+
+#ifndef HOST_ACTIVE_CURRENT_UA
+#define HOST_ACTIVE_CURRENT_UA 60000 //!< Consumo de la placa con el núcleo ejecutando, en microamperes
+#endif
+
+#ifndef HOST_SLEEP_CURRENT_UA
+#define HOST_SLEEP_CURRENT_UA 25000 //!< Consumo de la placa con el núcleo dormido en __WFI(), en microamperes
+#endif
+
+#ifndef HOST_SUPPLY_MV
+#define HOST_SUPPLY_MV 3300 //!< Tensión de alimentación, en milivolts
+#endif
+
+/** Puntero al modelo del SCU, equivalente al periférico de LPCOpen */
+#define LPC_SCU (host_scu)
+
+#define __NVIC_PRIO_BITS 3 //!< Bits de prioridad implementados en el NVIC del Cortex-M4 del LPC43xx
+
+/** Puntero al modelo de los puertos GPIO, equivalente al periférico de LPCOpen */
+#define LPC_GPIO_PORT (host_gpio_port)
+
+/** Puntero al modelo del temporizador de interrupción repetitiva, equivalente al periférico de LPCOpen */
+#define LPC_RITIMER (&host_ritimer)
+
+#define RIT_CTRL_INT   (1 << 0) //!< Interrupción pendiente, se borra escribiendo un uno
+#define RIT_CTRL_ENCLR (1 << 1) //!< El contador vuelve a cero al alcanzar la comparación
+#define RIT_CTRL_ENBR  (1 << 2) //!< El contador se detiene con el depurador
+#define RIT_CTRL_TEN   (1 << 3) //!< Contador habilitado
+
+/** Puntero al modelo del temporizador del sistema, equivalente al de CMSIS */
+#define SysTick (&host_systick)
+
+#define SysTick_CTRL_ENABLE_Msk    (1UL << 0) //!< Contador habilitado
+#define SysTick_CTRL_TICKINT_Msk   (1UL << 1) //!< Interrupción al llegar a cero
+#define SysTick_CTRL_CLKSOURCE_Msk (1UL << 2) //!< El contador usa el reloj del núcleo
+
+#define HOST_PININT_CHANNELS 8 //!< Cantidad de canales de interrupción por pin del LPC43xx
+
+/** Puntero al modelo de las interrupciones por pin, equivalente al periférico de LPCOpen */
+#define LPC_GPIO_PIN_INT (host_pin_int)
+
+/** Máscara de un canal de interrupción por pin */
+#define PININTCH(ch) (1UL << (ch))
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Modelo de los puertos GPIO
+ *
+ * A diferencia del periférico real, el valor de los pines de entrada lo impone el programa de prueba con
+ * HostGpioSetInput(), por lo que se guarda separado del valor escrito en los pines de salida.
+ */
+typedef struct {
+    uint32_t DIR[HOST_GPIO_PORTS];   //!< Dirección de cada pin, uno para salida
+    uint32_t MASK[HOST_GPIO_PORTS];  //!< Bits que no modifican las escrituras enmascaradas
+    uint32_t PIN[HOST_GPIO_PORTS];   //!< Valor escrito en los pines de salida
+    uint32_t INPUT[HOST_GPIO_PORTS]; //!< Valor impuesto desde afuera en los pines de entrada
+    uint32_t WRITES;                 //!< Cantidad de escrituras realizadas en los registros de salida
+} LPC_GPIO_T;
+
+/**
+ * @brief Modelo del SCU, la configuración de la función y el modo eléctrico de cada pin
+ */
+typedef struct {
+    uint32_t SFSP[HOST_SCU_PORTS][HOST_SCU_PINS]; //!< Modo y función de cada pin
+    uint32_t WRITES;                              //!< Cantidad de escrituras realizadas en los registros
+} LPC_SCU_T;
+
+/**
+ * @brief Modelo de las interrupciones por pin
+ *
+ * En el LPC43xx la asignación de pines a canales está en el SCU; el modelo la guarda junto con el resto.
+ */
+typedef struct {
+    uint32_t ISEL;                      //!< Canales por nivel, el modelo solo detecta flancos
+    uint32_t IENR;                      //!< Canales que detectan flancos ascendentes
+    uint32_t IENF;                      //!< Canales que detectan flancos descendentes
+    uint32_t RISE;                      //!< Flancos ascendentes detectados
+    uint32_t FALL;                      //!< Flancos descendentes detectados
+    uint32_t IST;                       //!< Canales con una interrupción pendiente
+    uint8_t PORT[HOST_PININT_CHANNELS]; //!< Puerto GPIO asignado a cada canal
+    uint8_t PIN[HOST_PININT_CHANNELS];  //!< Bit del puerto asignado a cada canal
+    uint32_t SEL;                       //!< Canales con un pin asignado
+} LPC_PIN_INT_T;
+
+/**
+ * @brief Modelo del temporizador de interrupción repetitiva
+ *
+ * El contador no avanza en el modelo: mientras está habilitado interrumpe con el período de la comparación.
+ */
+typedef struct {
+    uint32_t COMPVAL; //!< Valor de comparación, en ciclos del núcleo
+    uint32_t MASK;    //!< Bits que no participan de la comparación
+    uint32_t CTRL;    //!< Control y estado de la interrupción
+    uint32_t COUNTER; //!< Valor del contador
+} LPC_RITIMER_T;
+
+/**
+ * @brief Modelo del temporizador del sistema
+ *
+ * Igual que en el RIT el contador no avanza: mientras está habilitado interrumpe con el período de la recarga. Se
+ * detiene borrando SysTick_CTRL_ENABLE_Msk y se vuelve a arrancar con SysTick_Config().
+ */
+typedef struct {
+    uint32_t CTRL;  //!< Control y estado
+    uint32_t LOAD;  //!< Valor de recarga, el período en ciclos del núcleo menos uno
+    uint32_t VAL;   //!< Valor del contador
+    uint32_t CALIB; //!< Calibración
+} SysTick_Type;
+
+/** Números de las interrupciones usadas por el firmware */
+typedef enum {
+    RITIMER_IRQn = 11,  //!< Interrupción del temporizador de interrupción repetitiva
+    PIN_INT0_IRQn = 32, //!< Interrupción del canal 0 de interrupciones por pin
+    PIN_INT1_IRQn = 33,
+    PIN_INT2_IRQn = 34,
+    PIN_INT3_IRQn = 35,
+    PIN_INT4_IRQn = 36,
+    PIN_INT5_IRQn = 37,
+    PIN_INT6_IRQn = 38,
+    PIN_INT7_IRQn = 39,
+    SysTick_IRQn = -1, //!< Interrupción del temporizador del sistema
+} IRQn_Type;
+
+/** Ramas de reloj de los periféricos usados por el firmware */
+typedef enum {
+    CLK_MX_RITIMER, //!< Reloj del temporizador de interrupción repetitiva, el mismo del núcleo
+} CHIP_CCU_CLK_T;
+
+/**
+ * @brief Función que se ejecuta en cada tick de la hora virtual, antes de la interrupción del temporizador
+ *
+ * @param now Hora virtual en microsegundos
+ */
+typedef void (*host_clock_hook_t)(uint64_t now);
+
+/**
+ * @brief Periféricos de un microcontrolador, para simular varias placas en un mismo programa
+ *
+ * Cada hilo accede a los periféricos del contexto que seleccionó con HostContextSelect(). El NVIC y el temporizador
+ * del sistema siguen siendo únicos: las placas simuladas a la vez no deben usar interrupciones por pin.
+ */
+typedef struct host_context_s {
+    LPC_GPIO_T gpio;        //!< Puertos GPIO
+    LPC_SCU_T scu;          //!< Configuración de los pines
+    LPC_PIN_INT_T pin_int;  //!< Interrupciones por pin
+} host_context_t;
+
+/**
+ * @brief Tiempo que el núcleo estuvo ejecutando y dormido, y la energía que consumió la placa
+ *
+ * El tiempo activo se mide en la PC, desde que __WFI() devuelve el control hasta la próxima llamada y mientras se
+ * ejecutan los manejadores de interrupción, y se multiplica por HOST_CORE_SLOWDOWN para estimar el del
+ * microcontrolador. El resto del tiempo del modelo, real o virtual, el núcleo está dormido.
+ */
+typedef struct host_energy_s {
+    uint64_t elapsed;   //!< Tiempo del modelo desde el primer __WFI(), en microsegundos
+    uint64_t active;    //!< Tiempo estimado con el núcleo ejecutando, en microsegundos
+    uint64_t sleep;     //!< Tiempo con el núcleo dormido, en microsegundos
+    uint64_t wakeups;   //!< Cantidad de veces que el núcleo despertó de __WFI()
+    double energy;      //!< Energía consumida por la placa, en microjoules
+} host_energy_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/** Modelo de los puertos GPIO utilizado por las funciones Chip_GPIO_*, propio de cada hilo */
+extern __thread LPC_GPIO_T * host_gpio_port;
+
+/** Modelo del SCU utilizado por las funciones Chip_SCU_*, propio de cada hilo */
+extern __thread LPC_SCU_T * host_scu;
+
+/** Frecuencia del núcleo en Hz, como la calcula SystemCoreClockUpdate() en el microcontrolador */
+extern uint32_t SystemCoreClock;
+
+/** Modelo de las interrupciones por pin utilizado por las funciones Chip_PININT_*, propio de cada hilo */
+extern __thread LPC_PIN_INT_T * host_pin_int;
+
+/** Modelo del temporizador de interrupción repetitiva utilizado por las funciones Chip_RIT_* */
+extern LPC_RITIMER_T host_ritimer;
+
+/** Modelo del temporizador del sistema utilizado por SysTick_Config() */
+extern SysTick_Type host_systick;
+
+/** Interrupciones habilitadas en el NVIC, un bit por número de interrupción */
+extern uint64_t host_nvic_enabled;
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Avisa que el firmware escribió un puerto GPIO
+ *
+ * Es opcional: si el programa que usa el modelo lo define, se llama después de cada escritura en los registros de
+ * salida, con las escrituras del mismo hilo ya aplicadas. Sirve para seguir la multiplexación de la pantalla, que
+ * cambia más rápido de lo que se puede muestrear desde otro hilo.
+ *
+ * @param port Puerto GPIO escrito
+ */
+void HostGpioWritten(uint8_t port) __attribute__((weak));
+
+/**
+ * @brief Impone el nivel de un pin de entrada, como lo haría el circuito externo
+ *
+ * Si el pin tiene asignado un canal de interrupción habilitado, el flanco ejecuta el GPIOn_IRQHandler del canal en el
+ * hilo que llama, con las interrupciones bloqueadas como lo estarían en el microcontrolador.
+ *
+ * @param port Puerto GPIO del pin
+ * @param pin Bit del pin dentro del puerto
+ * @param level Nivel lógico del pin
+ */
+void HostGpioSetInput(uint8_t port, uint8_t pin, bool level);
+
+/**
+ * @brief Vuelve todos los puertos GPIO, el SCU y las interrupciones por pin al estado de reset
+ */
+void HostGpioReset(void);
+
+/**
+ * @brief Selecciona los periféricos que usa el hilo que llama
+ *
+ * Al iniciar, todos los hilos comparten un único juego de periféricos. Un programa que simula varias placas crea un
+ * contexto para cada una y lo selecciona antes de ejecutar el firmware de esa placa, desde cualquier hilo.
+ *
+ * @param context Periféricos a usar, o NULL para volver a los compartidos
+ */
+void HostContextSelect(host_context_t * context);
+
+/**
+ * @brief Actualiza SystemCoreClock con la frecuencia del núcleo
+ */
+void SystemCoreClockUpdate(void);
+
+/**
+ * @brief Configura el temporizador del sistema para interrumpir cada una cantidad de ciclos del núcleo
+ *
+ * En la PC el temporizador es un timerfd de Linux atendido por un hilo, que ejecuta SysTick_Handler() con las
+ * interrupciones bloqueadas. Si el hilo se atrasa, ejecuta seguidas las interrupciones perdidas para que el firmware
+ * no pierda tiempo.
+ *
+ * @param ticks Ciclos del núcleo entre interrupciones
+ * @return uint32_t Cero si la configuración es válida, uno si la cantidad no entra en el temporizador
+ */
+uint32_t SysTick_Config(uint32_t ticks);
+
+/**
+ * @brief Inicializa el temporizador de interrupción repetitiva, que queda habilitado sin comparación
+ *
+ * @param pRITimer Temporizador a inicializar
+ */
+void Chip_RIT_Init(LPC_RITIMER_T * pRITimer);
+
+/**
+ * @brief Configura el período de la interrupción del temporizador de interrupción repetitiva
+ *
+ * Igual que el temporizador del sistema, en la PC lo atiende un hilo o, con la hora virtual, __WFI(). Cuando vence
+ * ejecuta RIT_IRQHandler() si la interrupción está habilitada en el NVIC.
+ *
+ * @param pRITimer Temporizador a configurar
+ * @param time_interval Período en milisegundos
+ */
+void Chip_RIT_SetTimerInterval(LPC_RITIMER_T * pRITimer, uint32_t time_interval);
+
+/**
+ * @brief Detiene el temporizador de interrupción repetitiva
+ *
+ * @param pRITimer Temporizador a detener
+ */
+void Chip_RIT_Disable(LPC_RITIMER_T * pRITimer);
+
+/**
+ * @brief Devuelve la frecuencia de la rama de reloj de un periférico
+ *
+ * @param clk Rama de reloj
+ * @return uint32_t Frecuencia en Hz, en la PC siempre la del núcleo
+ */
+uint32_t Chip_Clock_GetRate(CHIP_CCU_CLK_T clk);
+
+/**
+ * @brief Escribe el valor de comparación del temporizador de interrupción repetitiva
+ *
+ * Si el temporizador está habilitado, el modelo reprograma su período con el nuevo valor.
+ *
+ * @param pRITimer Temporizador a configurar
+ * @param val Período en ciclos del reloj del temporizador
+ */
+void Chip_RIT_SetCOMPVAL(LPC_RITIMER_T * pRITimer, uint32_t val);
+
+/**
+ * @brief Activa bits del registro de control del temporizador de interrupción repetitiva
+ *
+ * @param pRITimer Temporizador a configurar
+ * @param val Bits a activar, RIT_CTRL_*
+ */
+void Chip_RIT_EnableCTRL(LPC_RITIMER_T * pRITimer, uint32_t val);
+
+/**
+ * @brief Reemplaza el tiempo real por una hora virtual que solo avanza cuando el firmware espera
+ *
+ * Con la hora virtual los temporizadores no usan hilos: cada llamada a __WFI() avanza la hora hasta el próximo
+ * vencimiento, ejecuta la función indicada y después los manejadores de los temporizadores que vencieron, primero
+ * SysTick_Handler(), todo en el hilo del firmware. La ejecución es determinista y tan rápida como lo permita la PC. Se
+ * debe llamar antes de configurar los temporizadores y no se puede volver al tiempo real.
+ *
+ * @param hook Función que se ejecuta en cada tick, para imponer entradas y observar salidas
+ */
+void HostClockUseVirtual(host_clock_hook_t hook);
+
+/**
+ * @brief Devuelve la hora actual del modelo
+ *
+ * @return uint64_t Hora virtual en microsegundos o, en tiempo real, microsegundos desde un origen arbitrario
+ */
+uint64_t HostClockNow(void);
+
+/**
+ * @brief Calcula el tiempo activo y dormido del núcleo y la energía consumida desde el primer __WFI()
+ *
+ * @param energy Resultado de la contabilidad
+ */
+void HostEnergyGet(host_energy_t * energy);
+
+/**
+ * @brief Lee el contador de ciclos del núcleo del modelo, en lugar del CYCCNT de la unidad DWT
+ *
+ * Con la hora virtual cuenta los ciclos de la hora del modelo más el tiempo activo estimado desde que el núcleo
+ * despertó, como lo contabiliza HostEnergyGet(). En tiempo real cuenta los ciclos del reloj de la PC.
+ *
+ * @return uint32_t Ciclos del núcleo desde un origen arbitrario, da la vuelta como el contador del Cortex-M
+ */
+uint32_t HostCoreCycles(void);
+
+/**
+ * @brief Bloquea las interrupciones
+ *
+ * En la PC las interrupciones se ejecutan desde otros hilos, por lo que bloquearlas equivale a tomar un mutex
+ * recursivo que también toman los manejadores de interrupción antes de ejecutarse. Con la hora virtual no hay otros
+ * hilos que interrumpan y solo se cuentan las llamadas anidadas de cada hilo, así varios hilos pueden simular placas
+ * distintas sin esperarse.
+ */
+void __disable_irq(void);
+
+/**
+ * @brief Desbloquea las interrupciones bloqueadas con __disable_irq()
+ */
+void __enable_irq(void);
+
+/**
+ * @brief Indica si el hilo tiene bloqueadas las interrupciones, como el registro PRIMASK del Cortex-M
+ *
+ * @return uint32_t 1 si están bloqueadas, 0 si no
+ */
+uint32_t __get_PRIMASK(void);
+
+/**
+ * @brief Bloquea o desbloquea las interrupciones según un valor obtenido antes con __get_PRIMASK()
+ *
+ * Como en el Cortex-M el bloqueo es un solo bit: con 1 queda bloqueado una sola vez aunque se hayan anidado llamadas a
+ * __disable_irq(), y con 0 se desbloquean todas. Así una sección crítica que restaura el valor previo puede ejecutarse
+ * dentro de otra sin desbloquearla.
+ *
+ * @param primask 1 para bloquear las interrupciones, 0 para desbloquearlas
+ */
+void __set_PRIMASK(uint32_t primask);
+
+/**
+ * @brief Espera hasta la próxima interrupción
+ *
+ * Igual que en el Cortex-M, si se llama con las interrupciones bloqueadas la espera las libera y una interrupción que
+ * llegue entre la comprobación previa y la espera igual la despierta. Con la hora virtual, en cambio, los manejadores
+ * de los temporizadores que vencieron se ejecutan recién en el __enable_irq() que las desbloquea, como en el
+ * microcontrolador.
+ */
+void __WFI(void);
+
+static inline void NVIC_EnableIRQ(IRQn_Type irq) {
+    host_nvic_enabled |= (1ULL << irq);
+}
+
+static inline void NVIC_DisableIRQ(IRQn_Type irq) {
+    host_nvic_enabled &= ~(1ULL << irq);
+}
+
+static inline void NVIC_ClearPendingIRQ(IRQn_Type irq) {
+    (void)irq;
+}
+
+static inline void NVIC_SetPriority(IRQn_Type irq, uint32_t priority) {
+    (void)irq;
+    (void)priority;
+}
+
+static inline void Chip_RIT_ClearInt(LPC_RITIMER_T * pRITimer) {
+    pRITimer->CTRL &= ~RIT_CTRL_INT;
+}
+
+static inline void Chip_SCU_PinMuxSet(uint8_t port, uint8_t pin, uint16_t modefunc) {
+    LPC_SCU->WRITES++;
+    LPC_SCU->SFSP[port][pin] = modefunc;
+}
+
+static inline void Chip_SCU_GPIOIntPinSel(uint8_t PortSel, uint8_t PortNum, uint8_t PinNum) {
+    LPC_GPIO_PIN_INT->PORT[PortSel] = PortNum;
+    LPC_GPIO_PIN_INT->PIN[PortSel] = PinNum;
+    LPC_GPIO_PIN_INT->SEL |= PININTCH(PortSel);
+}
+
+static inline void Chip_PININT_SetPinModeEdge(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    pPININT->ISEL &= ~pins;
+}
+
+static inline void Chip_PININT_EnableIntHigh(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    pPININT->IENR |= pins;
+}
+
+static inline void Chip_PININT_EnableIntLow(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    pPININT->IENF |= pins;
+}
+
+static inline uint32_t Chip_PININT_GetRiseStates(LPC_PIN_INT_T * pPININT) {
+    return pPININT->RISE;
+}
+
+static inline void Chip_PININT_ClearRiseStates(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    pPININT->RISE &= ~pins;
+}
+
+static inline uint32_t Chip_PININT_GetFallStates(LPC_PIN_INT_T * pPININT) {
+    return pPININT->FALL;
+}
+
+static inline void Chip_PININT_ClearFallStates(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    pPININT->FALL &= ~pins;
+}
+
+static inline void Chip_PININT_ClearIntStatus(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    pPININT->IST &= ~pins;
+}
+
+/** Llama a HostGpioWritten() si el programa lo define */
+static inline void HostGpioNotify(uint8_t port) {
+    if (HostGpioWritten) {
+        HostGpioWritten(port);
+    }
+}
+
+static inline uint32_t Chip_GPIO_GetPortValue(LPC_GPIO_T * pGPIO, uint8_t port) {
+    return (pGPIO->PIN[port] & pGPIO->DIR[port]) | (pGPIO->INPUT[port] & ~pGPIO->DIR[port]);
+}
+
+static inline bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * pGPIO, uint32_t port, uint8_t pin) {
+    return (Chip_GPIO_GetPortValue(pGPIO, port) >> pin) & 1;
+}
+
+static inline void Chip_GPIO_SetPinState(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin, bool setting) {
+    pGPIO->WRITES++;
+    if (setting) {
+        pGPIO->PIN[port] |= (1UL << pin);
+    } else {
+        pGPIO->PIN[port] &= ~(1UL << pin);
+    }
+    HostGpioNotify(port);
+}
+
+static inline void Chip_GPIO_SetPinToggle(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin) {
+    pGPIO->WRITES++;
+    pGPIO->PIN[port] ^= (1UL << pin);
+    HostGpioNotify(port);
+}
+
+static inline void Chip_GPIO_SetPinDIR(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin, bool output) {
+    if (output) {
+        pGPIO->DIR[port] |= (1UL << pin);
+    } else {
+        pGPIO->DIR[port] &= ~(1UL << pin);
+    }
+}
+
+static inline void Chip_GPIO_SetPortDIROutput(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t pinMask) {
+    pGPIO->WRITES++;
+    pGPIO->DIR[port] |= pinMask;
+}
+
+static inline void Chip_GPIO_SetPortDIRInput(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t pinMask) {
+    pGPIO->WRITES++;
+    pGPIO->DIR[port] &= ~pinMask;
+}
+
+static inline void Chip_GPIO_SetValue(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t bitValue) {
+    pGPIO->WRITES++;
+    pGPIO->PIN[port] |= bitValue;
+    HostGpioNotify(port);
+}
+
+static inline void Chip_GPIO_ClearValue(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t bitValue) {
+    pGPIO->WRITES++;
+    pGPIO->PIN[port] &= ~bitValue;
+    HostGpioNotify(port);
+}
+
+static inline void Chip_GPIO_SetPortMask(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t mask) {
+    pGPIO->MASK[port] = mask;
+}
+
+static inline void Chip_GPIO_SetMaskedPortValue(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t value) {
+    pGPIO->WRITES++;
+    pGPIO->PIN[port] = (pGPIO->PIN[port] & pGPIO->MASK[port]) | (value & ~pGPIO->MASK[port]);
+    HostGpioNotify(port);
+}
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHIP_H_ */
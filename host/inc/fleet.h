@@ -0,0 +1,82 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef FLEET_H_
+#define FLEET_H_
+
+/** @file fleet.h
+ ** @brief Simulador de una flota de relojes con hora virtual, repartidos entre todos los núcleos de la PC
+ **
+ ** Cada reloj es una instancia de la aplicación con su propia placa y sus propios periféricos del modelo del HAL. El
+ ** programa crea todos los relojes y después los reparte entre varios hilos: cada hilo ejecuta un reloj completo por
+ ** vez, tick a tick, y al terminar con los suyos toma los pendientes de los demás. Cada reloj recibe pulsaciones al
+ ** azar y un corrimiento de su cristal, ambos derivados de la semilla para que la ejecución sea repetible.
+ **
+ ** Al terminar muestra los segundos de reloj simulados por segundo real, que deben crecer casi en proporción a la
+ ** cantidad de hilos mientras haya núcleos libres:
+ **
+ **     make -C host && ./build/host/fleet -d 256 -t 1h -j 8 -s 1
+ **
+ ** | Opción         | Efecto                                                                  |
+ ** |----------------|-------------------------------------------------------------------------|
+ ** | -d <relojes>   | Cantidad de relojes, hasta los que permite el firmware compilado        |
+ ** | -t <duración>  | Tiempo simulado de cada reloj, en segundos o con unidad s, m, h o d     |
+ ** | -j <hilos>     | Hilos de trabajo, por defecto uno por núcleo                            |
+ ** | -s <semilla>   | Semilla de las pulsaciones y los corrimientos                           |
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef FLEET_THREADS_MAX
+#define FLEET_THREADS_MAX 256 //!< Cantidad máxima de hilos de trabajo
+#endif
+
+#ifndef FLEET_DRIFT_PPM
+#define FLEET_DRIFT_PPM 100 //!< Corrimiento máximo del cristal de cada reloj, en partes por millón
+#endif
+
+#ifndef FLEET_PRESS_INTERVAL_S
+#define FLEET_PRESS_INTERVAL_S 600 //!< Tiempo medio entre pulsaciones de cada reloj, en segundos
+#endif
+
+#ifndef FLEET_PRESS_MAX_MS
+#define FLEET_PRESS_MAX_MS 4000 //!< Duración máxima de una pulsación, alcanza para las presiones largas
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLEET_H_ */
@@ -0,0 +1,86 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SIMULATOR_H_
+#define SIMULATOR_H_
+
+/** @file simulator.h
+ ** @brief Simulador del firmware completo con hora virtual, para probar semanas de funcionamiento en segundos
+ **
+ ** El simulador lee un guion de la entrada estándar al cargar el programa, antes del main() del firmware, y cambia el
+ ** modelo del HAL a la hora virtual: cada __WFI() del programa principal avanza hasta el próximo vencimiento de un
+ ** temporizador, aplica los eventos del guion que vencieron y ejecuta las interrupciones de los temporizadores. El
+ ** firmware se compila sin cambios y la ejecución es determinista.
+ **
+ ** Cada línea del guion tiene la hora del evento, un comando y sus argumentos. Las horas y duraciones se escriben como
+ ** una suma de cantidades con unidad, por ejemplo 1d, 2h30m, 45s o 3500ms. Las líneas vacías y las que empiezan con #
+ ** se ignoran.
+ **
+ ** | Comando                            | Efecto                                                              |
+ ** |------------------------------------|---------------------------------------------------------------------|
+ ** | press <tecla> [<duración>]         | Presiona f1, f2, f3, f4, accept o cancel, por defecto 100 ms          |
+ ** | show                               | Muestra la pantalla, el LED RGB y el zumbador                        |
+ ** | watch <período>                    | Muestra el estado periódicamente, 0 deja de mostrarlo                |
+ ** | expect <dígitos> [<indicadores>]   | Compara los dígitos y los indicadores RGBZ, _ es apagado y * cualquiera |
+ ** | load <porcentaje>                  | Compara la carga máxima del procesador, como 2.5 o 2.5%, con la medida |
+ ** | latency <duración>                 | Compara la latencia máxima de las teclas, como 30ms, con la medida   |
+ ** | trace <archivo>                    | Guarda el registro de eventos del firmware compilado con TRACE=1     |
+ ** | end                                | Termina la simulación y muestra el resumen                          |
+ **
+ ** Por ejemplo, para configurar la hora y comprobar que sigue en hora después de 30 días:
+ **
+ **     0s press f1 3500ms
+ **     4s press accept
+ **     5s press accept
+ **     6s expect 0000
+ **     30d10s expect 0000
+ **     30d10s end
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef SIMULATOR_EVENTS_MAX
+#define SIMULATOR_EVENTS_MAX 1024 //!< Cantidad máxima de eventos del guion
+#endif
+
+#ifndef SIMULATOR_CLICK_MS
+#define SIMULATOR_CLICK_MS 100 //!< Duración de una pulsación si el guion no la indica
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIMULATOR_H_ */
@@ -0,0 +1,57 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TRACEDECODE_H_
+#define TRACEDECODE_H_
+
+/** @file tracedecode.h
+ ** @brief Decodificador del registro binario de eventos del firmware, muestra una línea de tiempo legible
+ **
+ ** Lee una copia del anillo de trace.h, guardada por el comando trace del simulador o tomada del microcontrolador con
+ ** el depurador, por ejemplo con "dump binary value trace.bin 'trace.c'::trace" en gdb. Muestra los registros desde
+ ** el más antiguo que conserva el anillo, con el tiempo desde ese registro y desde el anterior:
+ **
+ **     make -C host clean all TRACE=1
+ **     ./build/host/simulator < guion.txt
+ **     ./build/host/tracedecode trace.bin
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACEDECODE_H_ */
@@ -0,0 +1,120 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef VIRTUAL_BOARD_H_
+#define VIRTUAL_BOARD_H_
+
+/** @file virtual_board.h
+ ** @brief Vista del poncho desde afuera, para los programas que ejecutan el firmware completo en la PC
+ **
+ ** Sigue las escrituras del firmware en el modelo de GPIO y reconstruye la imagen de la pantalla multiplexada tal como
+ ** la vería el ojo, el estado del LED RGB y del zumbador. También presiona y suelta las teclas del poncho.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define VIRTUAL_BOARD_DIGITS 4 //!< Cantidad de dígitos de la pantalla del poncho
+
+/** Largo del texto generado por VirtualBoardFormat(), con el terminador */
+#define VIRTUAL_BOARD_TEXT_LENGTH 32
+
+/* === Public data type declarations =============================================================================== */
+
+/** Teclas del poncho */
+typedef enum {
+    VIRTUAL_KEY_F1,     //!< Tecla F1, ajuste de la hora
+    VIRTUAL_KEY_F2,     //!< Tecla F2, ajuste de la alarma
+    VIRTUAL_KEY_F3,     //!< Tecla F3, decremento
+    VIRTUAL_KEY_F4,     //!< Tecla F4, incremento
+    VIRTUAL_KEY_ACCEPT, //!< Tecla aceptar
+    VIRTUAL_KEY_CANCEL, //!< Tecla cancelar
+    VIRTUAL_KEYS_COUNT, //!< Cantidad de teclas
+} virtual_key_t;
+
+/** Estado visible del poncho */
+typedef struct virtual_board_state_s {
+    uint8_t segments[VIRTUAL_BOARD_DIGITS]; //!< Segmentos de cada dígito en el último barrido completo
+    bool red;                               //!< LED rojo encendido
+    bool green;                             //!< LED verde encendido
+    bool blue;                              //!< LED azul encendido
+    bool buzzer;                            //!< Zumbador sonando
+} virtual_board_state_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Suelta todas las teclas y descarta la imagen reconstruida de la pantalla
+ */
+void VirtualBoardReset(void);
+
+/**
+ * @brief Presiona o suelta una tecla del poncho
+ *
+ * @param key Tecla
+ * @param pressed true para presionarla, false para soltarla
+ */
+void VirtualBoardSetKey(virtual_key_t key, bool pressed);
+
+/**
+ * @brief Busca una tecla por su nombre
+ *
+ * @param name Nombre de la tecla: f1, f2, f3, f4, accept o cancel
+ * @return int Tecla encontrada o -1 si el nombre no corresponde a ninguna
+ */
+int VirtualBoardFindKey(const char * name);
+
+/**
+ * @brief Obtiene el estado visible del poncho
+ *
+ * @param state Puntero donde se copia el estado
+ */
+void VirtualBoardGetState(virtual_board_state_t * state);
+
+/**
+ * @brief Convierte la pantalla en texto, como "12.34", y el resto del estado en indicadores
+ *
+ * Los dígitos que no se reconocen se muestran como '?' y los apagados como espacios.
+ *
+ * @param state Estado a convertir
+ * @param text Texto generado, de al menos VIRTUAL_BOARD_TEXT_LENGTH caracteres
+ * @param digits Texto de los dígitos sin los puntos, de al menos VIRTUAL_BOARD_DIGITS + 1 caracteres, o NULL
+ */
+void VirtualBoardFormat(const virtual_board_state_t * state, char text[], char digits[]);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VIRTUAL_BOARD_H_ */
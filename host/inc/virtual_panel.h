@@ -0,0 +1,86 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef VIRTUAL_PANEL_H_
+#define VIRTUAL_PANEL_H_
+
+/** @file virtual_panel.h
+ ** @brief Panel frontal del poncho en la terminal, para usar el firmware completo compilado para la PC
+ **
+ ** El panel dibuja en la terminal la pantalla, el LED RGB y el zumbador tal como los reconstruye virtual_board.h,
+ ** cada vez que cambian. Las teclas de la terminal se convierten en pulsaciones de las teclas del poncho. Se inicia solo al cargar el programa, antes del main() del
+ ** firmware, que así se compila sin cambios.
+ **
+ ** | Terminal | Tecla     | Pulsación                   |
+ ** |----------|-----------|-----------------------------|
+ ** | t / T    | F1        | corta / larga               |
+ ** | a / A    | F2        | corta / larga               |
+ ** | - / _    | F3        | corta / mantenida un segundo |
+ ** | + / =    | F4        | corta / mantenida un segundo |
+ ** | Enter    | Aceptar   | corta                       |
+ ** | x        | Cancelar  | corta                       |
+ ** | q        | -         | termina el programa         |
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef VIRTUAL_PANEL_CLICK_MS
+#define VIRTUAL_PANEL_CLICK_MS 100 //!< Duración de una pulsación corta
+#endif
+
+#ifndef VIRTUAL_PANEL_HOLD_MS
+#define VIRTUAL_PANEL_HOLD_MS 1000 //!< Duración de una pulsación mantenida, suficiente para la repetición automática
+#endif
+
+#ifndef VIRTUAL_PANEL_LONG_MS
+#define VIRTUAL_PANEL_LONG_MS 3500 //!< Duración de una pulsación larga, mayor que BUTTON_SET_DELAY
+#endif
+
+#ifndef VIRTUAL_PANEL_FRAME_MS
+#define VIRTUAL_PANEL_FRAME_MS 50 //!< Intervalo entre actualizaciones de la terminal
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Suelta todas las teclas del poncho y arranca el hilo que atiende la terminal
+ *
+ * Se llama automáticamente al cargar el programa; las llamadas siguientes no tienen efecto.
+ */
+void VirtualPanelStart(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VIRTUAL_PANEL_H_ */
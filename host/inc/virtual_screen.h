@@ -0,0 +1,136 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef VIRTUAL_SCREEN_H_
+#define VIRTUAL_SCREEN_H_
+
+/** @file virtual_screen.h
+ ** @brief Driver de pantalla virtual para ejecutar y medir el módulo screen en la PC
+ **
+ ** El driver registra cada llamada a DigitsTurnOff, SegmentsUpdate y DigitTurnOn con la hora virtual fijada por el
+ ** programa de prueba, reconstruye la imagen que percibe el ojo en cada cuadro y calcula la frecuencia de refresco,
+ ** el ciclo de trabajo de cada dígito y el parpadeo.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "screen.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef VIRTUAL_SCREEN_MAX_DIGITS
+#define VIRTUAL_SCREEN_MAX_DIGITS 8 //!< Cantidad máxima de dígitos de la pantalla virtual
+#endif
+
+#ifndef VIRTUAL_SCREEN_MAX_FRAMES
+#define VIRTUAL_SCREEN_MAX_FRAMES 64 //!< Cantidad de cuadros que se conservan en el registro
+#endif
+
+#ifndef VIRTUAL_SCREEN_FLICKER_HZ
+#define VIRTUAL_SCREEN_FLICKER_HZ 50 //!< Frecuencia por debajo de la cual un dígito se percibe parpadeando
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Imagen percibida al completar un barrido de todos los dígitos
+ */
+typedef struct virtual_frame_s {
+    uint32_t timestamp;                          //!< Hora virtual en microsegundos al completar el cuadro
+    uint8_t segments[VIRTUAL_SCREEN_MAX_DIGITS]; //!< Segmentos mostrados en cada dígito durante el cuadro
+} virtual_frame_t;
+
+/**
+ * @brief Estadísticas acumuladas desde la última llamada a VirtualScreenInit()
+ */
+typedef struct virtual_screen_stats_s {
+    uint32_t frames;                            //!< Cantidad de cuadros completos
+    uint32_t refresh_rate;                      //!< Cuadros completos por segundo
+    uint16_t duty[VIRTUAL_SCREEN_MAX_DIGITS];   //!< Tiempo encendido de cada dígito, en milésimas del total
+    uint32_t max_dark[VIRTUAL_SCREEN_MAX_DIGITS]; //!< Mayor tiempo apagado de cada dígito, en microsegundos
+    bool flicker;                               //!< Algún dígito estuvo apagado más de 1/VIRTUAL_SCREEN_FLICKER_HZ
+    uint32_t calls;                             //!< Cantidad total de llamadas al driver
+    uint32_t ghosting;                          //!< Segmentos cambiados con un dígito encendido
+} virtual_screen_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Reinicia la pantalla virtual, su registro de cuadros y sus estadísticas
+ *
+ * @param digits Cantidad de dígitos de la pantalla
+ */
+void VirtualScreenInit(uint8_t digits);
+
+/**
+ * @brief Devuelve el driver que se debe pasar a ScreenCreate()
+ *
+ * @return screen_driver_t Driver de la pantalla virtual
+ */
+screen_driver_t VirtualScreenDriver(void);
+
+/**
+ * @brief Avanza la hora virtual con la que se registran las llamadas al driver
+ *
+ * @param microseconds Tiempo transcurrido desde la llamada anterior
+ */
+void VirtualScreenAdvance(uint32_t microseconds);
+
+/**
+ * @brief Obtiene uno de los últimos cuadros registrados
+ *
+ * @param age Antigüedad del cuadro, cero es el último cuadro completo
+ * @param frame Puntero donde se copia el cuadro
+ * @return true si el cuadro existe, false si todavía no se completaron tantos cuadros
+ */
+bool VirtualScreenGetFrame(uint32_t age, virtual_frame_t * frame);
+
+/**
+ * @brief Obtiene las estadísticas de refresco acumuladas
+ *
+ * @param stats Puntero donde se copian las estadísticas
+ */
+void VirtualScreenGetStats(virtual_screen_stats_t * stats);
+
+/**
+ * @brief Dibuja un cuadro en una terminal usando caracteres ASCII
+ *
+ * @param output Archivo donde se escribe el dibujo, por ejemplo stdout
+ * @param frame Cuadro a dibujar
+ */
+void VirtualScreenRender(FILE * output, const virtual_frame_t * frame);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VIRTUAL_SCREEN_H_ */
@@ -0,0 +1,617 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file chip.c
+ ** @brief Implementación del modelo del HAL del LPC43xx para la PC
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _XOPEN_SOURCE 700 // Mutex recursivos de POSIX
+
+#include "chip.h"
+#include <pthread.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** Con la hora virtual se mide un despertar de cada tantos, primo para no coincidir con los períodos del firmware */
+#define HOST_LOAD_SAMPLE_PERIOD 61
+
+/* === Private data type declarations ============================================================================== */
+
+/** Manejador de una interrupción */
+typedef void (*host_irq_handler_t)(void);
+
+/** Temporizador del modelo, la tabla con todos está junto con el resto del estado */
+struct host_timer_s;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Ejecuta el manejador de una interrupción con las interrupciones bloqueadas y despierta a __WFI()
+ *
+ * @param irq Número de la interrupción
+ * @param handler Manejador de la interrupción, puede ser NULL si el firmware no lo define
+ */
+static void HostIrqExecute(IRQn_Type irq, host_irq_handler_t handler);
+
+/**
+ * @brief Lee el reloj monotónico de la PC
+ *
+ * @return uint64_t Nanosegundos desde un origen arbitrario
+ */
+static uint64_t HostNanoseconds(void);
+
+/**
+ * @brief Suma al tiempo activo lo que ejecutó el programa principal desde que despertó, justo antes de dormir
+ */
+static void HostLoadSleep(void);
+
+/**
+ * @brief Registra que el programa principal despertó de __WFI()
+ */
+static void HostLoadResume(void);
+
+/**
+ * @brief Busca el próximo vencimiento de los temporizadores en marcha
+ *
+ * @return uint64_t Hora del vencimiento en nanosegundos, UINT64_MAX si no hay temporizadores en marcha
+ */
+static uint64_t HostTimersNext(void);
+
+/**
+ * @brief Ejecuta los manejadores de los temporizadores que vencieron con la hora virtual, en orden de prioridad
+ */
+static void HostTimersRun(void);
+
+/**
+ * @brief Indica si un temporizador está en marcha, el del sistema además debe estar habilitado en su registro
+ *
+ * @param timer Temporizador a consultar
+ * @return true si el temporizador interrumpe
+ */
+static bool HostTimerRunning(const struct host_timer_s * timer);
+
+/**
+ * @brief Hilo de un temporizador, ejecuta una interrupción por cada vencimiento del timerfd
+ *
+ * @param arguments Temporizador que atiende el hilo
+ * @return void* Siempre NULL, el hilo termina solo si falla la lectura del timerfd
+ */
+static void * HostTimerThread(void * arguments);
+
+/**
+ * @brief Arranca o detiene un temporizador
+ *
+ * @param timer Temporizador a configurar
+ * @param period Período en nanosegundos, cero para detenerlo
+ * @return true si se pudo configurar
+ */
+static bool HostTimerStart(struct host_timer_s * timer, uint64_t period);
+
+/* Manejadores de los temporizadores, definidos por el firmware que los use */
+void SysTick_Handler(void) __attribute__((weak));
+void RIT_IRQHandler(void) __attribute__((weak));
+
+/* Manejadores de las interrupciones por pin, definidos por el firmware que los use */
+void GPIO0_IRQHandler(void) __attribute__((weak));
+void GPIO1_IRQHandler(void) __attribute__((weak));
+void GPIO2_IRQHandler(void) __attribute__((weak));
+void GPIO3_IRQHandler(void) __attribute__((weak));
+void GPIO4_IRQHandler(void) __attribute__((weak));
+void GPIO5_IRQHandler(void) __attribute__((weak));
+void GPIO6_IRQHandler(void) __attribute__((weak));
+void GPIO7_IRQHandler(void) __attribute__((weak));
+
+/* === Private variable definitions ================================================================================ */
+
+static LPC_GPIO_T host_gpio;
+
+static LPC_PIN_INT_T host_pin_int_registers;
+
+static LPC_SCU_T host_scu_registers;
+
+//! Temporizadores del modelo, en orden de prioridad de sus interrupciones
+static struct host_timer_s {
+    IRQn_Type irq;               //!< Interrupción del temporizador
+    host_irq_handler_t handler;  //!< Manejador de la interrupción
+    uint64_t period;             //!< Período en nanosegundos, cero si no está en marcha
+    uint64_t next;               //!< Próximo vencimiento con la hora virtual, en nanosegundos
+    int timer;                   //!< Descriptor del timerfd, negativo si todavía no se creó
+    pthread_t thread;            //!< Hilo que atiende los vencimientos del timerfd
+} host_timers[] = {
+    {.irq = SysTick_IRQn, .handler = SysTick_Handler, .timer = -1},
+    {.irq = RITIMER_IRQn, .handler = RIT_IRQHandler, .timer = -1},
+};
+
+#define HOST_TIMER_SYSTICK (&host_timers[0]) //!< Temporizador del sistema
+#define HOST_TIMER_RIT     (&host_timers[1]) //!< Temporizador de interrupción repetitiva
+#define HOST_TIMERS_COUNT  (sizeof(host_timers) / sizeof(host_timers[0]))
+
+//! Manejadores de cada canal de interrupción por pin
+static host_irq_handler_t const PININT_HANDLERS[HOST_PININT_CHANNELS] = {
+    GPIO0_IRQHandler, GPIO1_IRQHandler, GPIO2_IRQHandler, GPIO3_IRQHandler,
+    GPIO4_IRQHandler, GPIO5_IRQHandler, GPIO6_IRQHandler, GPIO7_IRQHandler,
+};
+
+//! Estado de las interrupciones del modelo
+static struct {
+    pthread_mutex_t lock;       //!< Tomado mientras las interrupciones están bloqueadas o se ejecuta un manejador
+    pthread_cond_t wakeup;      //!< Señalada después de ejecutar cada manejador
+    pthread_once_t once;        //!< Inicialización del mutex recursivo
+    pthread_t owner;            //!< Hilo que tiene bloqueadas las interrupciones
+    unsigned int depth;         //!< Cantidad de llamadas anidadas a __disable_irq() del hilo dueño
+    unsigned long generation;   //!< Cantidad de interrupciones ejecutadas
+} host_irq[1] = {{.wakeup = PTHREAD_COND_INITIALIZER, .once = PTHREAD_ONCE_INIT}};
+
+//! Hora virtual, se usa en lugar del tiempo real si hook no es NULL
+static struct {
+    host_clock_hook_t hook; //!< Función que se ejecuta en cada tick
+    uint64_t now;           //!< Hora virtual en nanosegundos
+} host_clock[1];
+
+//! Con la hora virtual, cantidad de llamadas anidadas a __disable_irq() del hilo
+static __thread unsigned int host_clock_masked;
+
+//! Con la hora virtual, indica que hay temporizadores vencidos esperando a que se desbloqueen las interrupciones
+static __thread bool host_clock_pending;
+
+//! Contabilidad del tiempo que el núcleo ejecuta, medido con el reloj de la PC
+static struct {
+    uint64_t started;  //!< Hora del modelo en el primer __WFI(), en microsegundos
+    uint64_t resumed;  //!< Nanosegundos de la PC en que el programa principal salió de __WFI()
+    uint64_t active;   //!< Nanosegundos de la PC ejecutando el firmware
+    uint64_t wakeups;  //!< Cantidad de salidas de __WFI()
+    uint32_t weight;   //!< Despertares que representa el que se está midiendo, cero si no se mide
+    bool asleep;       //!< El programa principal está dentro de __WFI()
+    uint64_t average;  //!< Nanosegundos del núcleo activo en cada despertar, se actualiza en los que se miden
+    bool counted;      //!< Se leyó el contador de ciclos desde que el núcleo despertó
+} host_load[1];
+
+/* === Public variable definitions ================================================================================= */
+
+__thread LPC_GPIO_T * host_gpio_port = &host_gpio;
+
+__thread LPC_PIN_INT_T * host_pin_int = &host_pin_int_registers;
+
+__thread LPC_SCU_T * host_scu = &host_scu_registers;
+
+uint32_t SystemCoreClock;
+
+LPC_RITIMER_T host_ritimer;
+
+SysTick_Type host_systick;
+
+uint64_t host_nvic_enabled;
+
+/* === Private function definitions ================================================================================ */
+
+/**
+ * @brief Crea el mutex de las interrupciones, que debe ser recursivo para anidar secciones críticas
+ */
+static void HostIrqInit(void) {
+    pthread_mutexattr_t attributes;
+
+    pthread_mutexattr_init(&attributes);
+    pthread_mutexattr_settype(&attributes, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&host_irq->lock, &attributes);
+    pthread_mutexattr_destroy(&attributes);
+}
+
+static uint64_t HostNanoseconds(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static void HostLoadSleep(void) {
+    host_load->asleep = true;
+    if (host_load->wakeups == 0) {
+        host_load->started = HostClockNow();
+    } else if (host_load->weight != 0) {
+        host_load->active += (HostNanoseconds() - host_load->resumed) * host_load->weight;
+        host_load->average = (host_load->active * HOST_CORE_SLOWDOWN) / host_load->wakeups;
+    }
+}
+
+static void HostLoadResume(void) {
+    /* Leer el reloj de la PC cuesta casi lo mismo que un tick con la hora virtual, se mide uno cada tantos */
+    host_load->asleep = false;
+    host_load->counted = false;
+    host_load->wakeups++;
+    host_load->weight = (host_clock->hook == NULL) ? 1 : HOST_LOAD_SAMPLE_PERIOD;
+    if ((host_load->wakeups % host_load->weight) != 0) {
+        host_load->weight = 0;
+    } else {
+        host_load->resumed = HostNanoseconds();
+    }
+}
+
+static void HostIrqExecute(IRQn_Type irq, host_irq_handler_t handler) {
+    uint64_t started;
+
+    __disable_irq();
+    if (irq == RITIMER_IRQn) {
+        host_ritimer.CTRL |= RIT_CTRL_INT;
+    }
+    /* Las excepciones del sistema tienen números negativos y no dependen del NVIC */
+    if ((handler != NULL) && ((irq < 0) || (host_nvic_enabled & (1ULL << irq)))) {
+        /* Con el programa principal despierto el manejador ya cuenta dentro de su tiempo activo */
+        if ((host_load->weight != 0) && host_load->asleep) {
+            started = HostNanoseconds();
+            handler();
+            host_load->active += (HostNanoseconds() - started) * host_load->weight;
+        } else {
+            handler();
+        }
+    }
+    host_irq->generation++;
+    if (host_clock->hook == NULL) {
+        pthread_cond_broadcast(&host_irq->wakeup);
+    }
+    __enable_irq();
+}
+
+static uint64_t HostTimersNext(void) {
+    uint64_t next = UINT64_MAX;
+
+    for (size_t index = 0; index < HOST_TIMERS_COUNT; index++) {
+        if (HostTimerRunning(&host_timers[index]) && (host_timers[index].next < next)) {
+            next = host_timers[index].next;
+        }
+    }
+    return next;
+}
+
+static void HostTimersRun(void) {
+    host_clock_pending = false;
+    for (size_t index = 0; index < HOST_TIMERS_COUNT; index++) {
+        if (HostTimerRunning(&host_timers[index]) && (host_timers[index].next <= host_clock->now)) {
+            host_timers[index].next += host_timers[index].period;
+            HostIrqExecute(host_timers[index].irq, host_timers[index].handler);
+        }
+    }
+}
+
+static void * HostTimerThread(void * arguments) {
+    struct host_timer_s * timer = arguments;
+    uint64_t expirations;
+
+    while (read(timer->timer, &expirations, sizeof(expirations)) == sizeof(expirations)) {
+        for (; (expirations > 0) && HostTimerRunning(timer); expirations--) {
+            HostIrqExecute(timer->irq, timer->handler);
+        }
+    }
+    return NULL;
+}
+
+static bool HostTimerRunning(const struct host_timer_s * timer) {
+    if (timer == HOST_TIMER_SYSTICK) {
+        return (timer->period != 0) && (host_systick.CTRL & SysTick_CTRL_ENABLE_Msk);
+    }
+    return timer->period != 0;
+}
+
+static bool HostTimerStart(struct host_timer_s * timer, uint64_t period) {
+    struct itimerspec timing = {
+        .it_interval = {.tv_sec = period / 1000000000ULL, .tv_nsec = period % 1000000000ULL},
+        .it_value = {.tv_sec = period / 1000000000ULL, .tv_nsec = period % 1000000000ULL},
+    };
+
+    timer->period = period;
+    timer->next = host_clock->now + period;
+    if (host_clock->hook != NULL) {
+        return true;
+    }
+
+    if (timer->timer < 0) {
+        timer->timer = timerfd_create(CLOCK_MONOTONIC, 0);
+        if ((timer->timer < 0) || (pthread_create(&timer->thread, NULL, HostTimerThread, timer) != 0)) {
+            timer->period = 0;
+            return false;
+        }
+    }
+    if (timerfd_settime(timer->timer, 0, &timing, NULL) != 0) {
+        timer->period = 0;
+        return false;
+    }
+    return true;
+}
+
+/* === Public function implementation ============================================================================== */
+
+void HostGpioSetInput(uint8_t port, uint8_t pin, bool level) {
+    uint32_t pins = 0;
+
+    __disable_irq();
+    bool previous = (LPC_GPIO_PORT->INPUT[port] & (1UL << pin)) != 0;
+    if (level) {
+        LPC_GPIO_PORT->INPUT[port] |= (1UL << pin);
+    } else {
+        LPC_GPIO_PORT->INPUT[port] &= ~(1UL << pin);
+    }
+
+    for (uint8_t channel = 0; (channel < HOST_PININT_CHANNELS) && (level != previous); channel++) {
+        if ((LPC_GPIO_PIN_INT->SEL & PININTCH(channel)) && (LPC_GPIO_PIN_INT->PORT[channel] == port) &&
+            (LPC_GPIO_PIN_INT->PIN[channel] == pin)) {
+            if (level && (LPC_GPIO_PIN_INT->IENR & PININTCH(channel))) {
+                LPC_GPIO_PIN_INT->RISE |= PININTCH(channel);
+                pins |= PININTCH(channel);
+            } else if (!level && (LPC_GPIO_PIN_INT->IENF & PININTCH(channel))) {
+                LPC_GPIO_PIN_INT->FALL |= PININTCH(channel);
+                pins |= PININTCH(channel);
+            }
+        }
+    }
+    LPC_GPIO_PIN_INT->IST |= pins;
+    __enable_irq();
+
+    for (uint8_t channel = 0; channel < HOST_PININT_CHANNELS; channel++) {
+        if (pins & PININTCH(channel)) {
+            HostIrqExecute(PIN_INT0_IRQn + channel, PININT_HANDLERS[channel]);
+        }
+    }
+}
+
+void HostGpioReset(void) {
+    __disable_irq();
+    memset(LPC_GPIO_PORT, 0, sizeof(LPC_GPIO_T));
+    memset(LPC_GPIO_PIN_INT, 0, sizeof(LPC_PIN_INT_T));
+    memset(LPC_SCU, 0, sizeof(LPC_SCU_T));
+    host_nvic_enabled = 0;
+    __enable_irq();
+}
+
+void HostContextSelect(host_context_t * context) {
+    if (context == NULL) {
+        host_gpio_port = &host_gpio;
+        host_scu = &host_scu_registers;
+        host_pin_int = &host_pin_int_registers;
+    } else {
+        host_gpio_port = &context->gpio;
+        host_scu = &context->scu;
+        host_pin_int = &context->pin_int;
+    }
+}
+
+void SystemCoreClockUpdate(void) {
+    SystemCoreClock = 204000000;
+}
+
+uint32_t SysTick_Config(uint32_t ticks) {
+    if ((ticks == 0) || (ticks > (1UL << 24))) {
+        return 1;
+    }
+    if (SystemCoreClock == 0) {
+        SystemCoreClockUpdate();
+    }
+    host_systick.LOAD = ticks - 1;
+    host_systick.VAL = 0;
+    host_systick.CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+
+    return HostTimerStart(HOST_TIMER_SYSTICK, ((uint64_t)ticks * 1000000000ULL) / SystemCoreClock) ? 0 : 1;
+}
+
+void Chip_RIT_Init(LPC_RITIMER_T * pRITimer) {
+    pRITimer->COMPVAL = 0xFFFFFFFF;
+    pRITimer->MASK = 0;
+    pRITimer->CTRL = RIT_CTRL_ENBR | RIT_CTRL_TEN;
+    pRITimer->COUNTER = 0;
+}
+
+void Chip_RIT_SetTimerInterval(LPC_RITIMER_T * pRITimer, uint32_t time_interval) {
+    if (SystemCoreClock == 0) {
+        SystemCoreClockUpdate();
+    }
+    pRITimer->COMPVAL = (SystemCoreClock / 1000) * time_interval;
+    pRITimer->CTRL |= RIT_CTRL_ENCLR;
+    if (pRITimer->CTRL & RIT_CTRL_TEN) {
+        HostTimerStart(HOST_TIMER_RIT, (uint64_t)time_interval * 1000000ULL);
+    }
+}
+
+void Chip_RIT_Disable(LPC_RITIMER_T * pRITimer) {
+    pRITimer->CTRL &= ~RIT_CTRL_TEN;
+    HostTimerStart(HOST_TIMER_RIT, 0);
+}
+
+uint32_t Chip_Clock_GetRate(CHIP_CCU_CLK_T clk) {
+    (void)clk;
+    if (SystemCoreClock == 0) {
+        SystemCoreClockUpdate();
+    }
+    return SystemCoreClock;
+}
+
+void Chip_RIT_SetCOMPVAL(LPC_RITIMER_T * pRITimer, uint32_t val) {
+    pRITimer->COMPVAL = val;
+    if (pRITimer->CTRL & RIT_CTRL_TEN) {
+        HostTimerStart(HOST_TIMER_RIT, ((uint64_t)val * 1000000000ULL) / Chip_Clock_GetRate(CLK_MX_RITIMER));
+    }
+}
+
+void Chip_RIT_EnableCTRL(LPC_RITIMER_T * pRITimer, uint32_t val) {
+    pRITimer->CTRL |= val;
+}
+
+void HostClockUseVirtual(host_clock_hook_t hook) {
+    host_clock->hook = hook;
+}
+
+uint64_t HostClockNow(void) {
+    struct timespec now;
+
+    if (host_clock->hook != NULL) {
+        return host_clock->now / 1000;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+}
+
+void HostEnergyGet(host_energy_t * energy) {
+    uint64_t active;
+
+    __disable_irq();
+    active = host_load->active;
+    energy->wakeups = host_load->wakeups;
+    energy->elapsed = (host_load->wakeups == 0) ? 0 : HostClockNow() - host_load->started;
+    __enable_irq();
+
+    /* Lo que la PC ejecuta en un nanosegundo, al microcontrolador le lleva HOST_CORE_SLOWDOWN */
+    active = (active * HOST_CORE_SLOWDOWN) / 1000;
+    energy->active = (active < energy->elapsed) ? active : energy->elapsed;
+    energy->sleep = energy->elapsed - energy->active;
+    energy->energy = ((double)energy->active * HOST_ACTIVE_CURRENT_UA + (double)energy->sleep * HOST_SLEEP_CURRENT_UA) *
+                     HOST_SUPPLY_MV / 1e9;
+}
+
+uint32_t HostCoreCycles(void) {
+    uint64_t now, active = 0, limit;
+
+    if (SystemCoreClock == 0) {
+        SystemCoreClockUpdate();
+    }
+    if (host_clock->hook == NULL) {
+        now = HostNanoseconds();
+    } else {
+        /* La hora virtual no avanza mientras se ejecuta, se le suma lo que lleva activo el núcleo desde que despertó. En
+         * los despertares que no se miden se supone que ejecuta el promedio justo después de la primera lectura. */
+        now = host_clock->now;
+        if (!host_load->asleep && (host_load->weight != 0)) {
+            /* Si la PC demoró al programa, el contador no debe pasar el próximo vencimiento para seguir creciendo */
+            active = (HostNanoseconds() - host_load->resumed) * HOST_CORE_SLOWDOWN;
+            limit = HostTimersNext() - now;
+            if (active >= limit) {
+                active = (limit > 0) ? limit - 1 : 0;
+            }
+        } else if (!host_load->asleep && host_load->counted) {
+            active = host_load->average;
+        }
+        host_load->counted = true;
+        now += active;
+    }
+    return (uint32_t)((now * (SystemCoreClock / 1000000)) / 1000);
+}
+
+void __disable_irq(void) {
+    /* Con la hora virtual las interrupciones se ejecutan en el hilo del firmware y no hace falta el mutex */
+    if (host_clock->hook != NULL) {
+        host_clock_masked++;
+        return;
+    }
+    pthread_once(&host_irq->once, HostIrqInit);
+    pthread_mutex_lock(&host_irq->lock);
+    host_irq->owner = pthread_self();
+    host_irq->depth++;
+}
+
+void __enable_irq(void) {
+    if (host_clock->hook != NULL) {
+        if ((host_clock_masked > 0) && (--host_clock_masked == 0) && host_clock_pending) {
+            HostTimersRun();
+        }
+        return;
+    }
+    if ((host_irq->depth > 0) && pthread_equal(host_irq->owner, pthread_self())) {
+        host_irq->depth--;
+        pthread_mutex_unlock(&host_irq->lock);
+    }
+}
+
+uint32_t __get_PRIMASK(void) {
+    if (host_clock->hook != NULL) {
+        return host_clock_masked != 0;
+    }
+    return (host_irq->depth > 0) && pthread_equal(host_irq->owner, pthread_self());
+}
+
+void __set_PRIMASK(uint32_t primask) {
+    if (primask == 0) {
+        while (__get_PRIMASK()) {
+            __enable_irq();
+        }
+        return;
+    }
+    if (!__get_PRIMASK()) {
+        __disable_irq();
+    }
+    /* Las llamadas anidadas que sobran se liberan sin llegar a desbloquear */
+    while (((host_clock->hook != NULL) ? host_clock_masked : host_irq->depth) > 1) {
+        __enable_irq();
+    }
+}
+
+void __WFI(void) {
+    unsigned int depth = 0;
+    unsigned long generation;
+
+    /* La hora virtual avanza hasta la próxima interrupción del temporizador, que se ejecuta en este mismo hilo */
+    if (host_clock->hook != NULL) {
+        uint64_t next = HostTimersNext();
+
+        /* Como en el Cortex-M, una interrupción pendiente no deja dormir al núcleo */
+        if (host_clock_pending) {
+            return;
+        }
+        if (next == UINT64_MAX) {
+            return; // Sin temporizadores en marcha no hay nada que lo despierte
+        }
+        HostLoadSleep();
+        host_clock->now = next;
+        host_clock->hook(host_clock->now / 1000);
+        host_clock_pending = true;
+        /* Con las interrupciones bloqueadas el núcleo despierta y los manejadores esperan a __enable_irq() */
+        if (host_clock_masked == 0) {
+            HostTimersRun();
+        }
+        HostLoadResume();
+        return;
+    }
+
+    __disable_irq();
+    HostLoadSleep();
+    /* La espera necesita el mutex tomado una sola vez para poder liberarlo */
+    while (host_irq->depth > 1) {
+        host_irq->depth--;
+        depth++;
+        pthread_mutex_unlock(&host_irq->lock);
+    }
+    generation = host_irq->generation;
+    while (generation == host_irq->generation) {
+        host_irq->depth = 0;
+        pthread_cond_wait(&host_irq->wakeup, &host_irq->lock);
+        host_irq->owner = pthread_self();
+        host_irq->depth = 1;
+    }
+    HostLoadResume();
+    while (depth > 0) {
+        pthread_mutex_lock(&host_irq->lock);
+        host_irq->depth++;
+        depth--;
+    }
+    __enable_irq();
+}
+
+/* === End of documentation ======================================================================================== */
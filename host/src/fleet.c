@@ -0,0 +1,378 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file fleet.c
+ ** @brief Implementación del simulador de una flota de relojes
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _XOPEN_SOURCE 700 // clock_gettime y getopt de POSIX
+
+#include "fleet.h"
+#include "app.h"
+#include "chip.h"
+#include "poncho.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define FLEET_KEYS_COUNT 6 //!< Teclas de cada placa que reciben pulsaciones
+
+#define PPM 1000000 //!< Partes por millón en una unidad
+
+#define MS_PER_TICK (1000 / APP_TICKS_PER_SECOND) //!< Milisegundos entre ticks del reloj
+
+/* === Private data type declarations ============================================================================== */
+
+/** Tecla de la placa, se presiona con nivel bajo */
+typedef struct fleet_key_s {
+    uint8_t gpio; //!< Puerto GPIO de la tecla
+    uint8_t bit;  //!< Bit de la tecla dentro del puerto
+} fleet_key_t;
+
+/** Reloj de la flota */
+typedef struct device_s {
+    host_context_t context; //!< Periféricos propios de la placa
+    board_t board;          //!< Placa del reloj, para seguir la frecuencia de barrido que pide su pantalla
+    app_t app;              //!< Aplicación que ejecuta la placa
+    uint64_t random;        //!< Estado del generador de números al azar
+    int32_t drift;          //!< Corrimiento del cristal en partes por millón
+    int32_t phase;          //!< Corrimiento acumulado, un tick de más o de menos al llegar a un millón
+    uint64_t press;         //!< Milisegundo de la próxima pulsación
+    uint64_t release;       //!< Milisegundo en que se suelta la tecla presionada
+    uint8_t key;            //!< Tecla presionada
+    uint32_t presses;       //!< Cantidad de pulsaciones realizadas
+    uint8_t elapsed;        //!< Milisegundos desde el último tick del reloj
+    uint32_t scans;         //!< Barridos pendientes, en milésimas
+} * device_t;
+
+/** Relojes asignados a un hilo, que los demás hilos pueden tomar cuando terminan con los suyos */
+typedef struct __attribute__((aligned(64))) worker_s { // Cada hilo en su propia línea de caché
+    uint32_t next;      //!< Próximo reloj sin tomar, se incrementa en forma atómica
+    uint32_t end;       //!< Primer reloj que no pertenece al hilo
+    uint32_t executed;  //!< Cantidad de relojes ejecutados por el hilo
+    uint32_t stolen;    //!< Cantidad de relojes ejecutados que pertenecían a otros hilos
+    pthread_t thread;   //!< Hilo de trabajo
+} * worker_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Genera un número al azar con el estado de un reloj, con el algoritmo xorshift64*
+ *
+ * @param device Reloj que genera el número
+ * @return uint32_t Número al azar
+ */
+static uint32_t Random(device_t device);
+
+/**
+ * @brief Convierte una duración de la línea de comandos en segundos
+ *
+ * @param text Texto a convertir, como 3600, 90m, 2h o 30d
+ * @param result Segundos
+ * @return true si el texto es válido
+ */
+static bool ParseDuration(const char * text, uint64_t * result);
+
+/**
+ * @brief Crea un reloj con sus periféricos, las teclas sueltas y un corrimiento al azar
+ *
+ * @param device Reloj a crear
+ * @param seed Semilla de la flota
+ * @param index Número del reloj en la flota
+ * @return true si el firmware pudo crear la aplicación
+ */
+static bool DeviceCreate(device_t device, uint64_t seed, uint32_t index);
+
+/**
+ * @brief Avanza un reloj un milisegundo, como lo harían sus temporizadores y el programa principal
+ *
+ * @param device Reloj a avanzar
+ */
+static void DeviceStep(device_t device);
+
+/**
+ * @brief Ejecuta un reloj durante todo el tiempo simulado
+ *
+ * @param device Reloj a ejecutar
+ */
+static void DeviceRun(device_t device);
+
+/**
+ * @brief Toma el próximo reloj pendiente de un hilo
+ *
+ * @param worker Hilo dueño de los relojes
+ * @return device_t Reloj tomado, o NULL si el hilo no tiene relojes pendientes
+ */
+static device_t WorkerTake(worker_t worker);
+
+/**
+ * @brief Ejecuta los relojes propios de un hilo y después los pendientes de los demás
+ *
+ * @param arguments Hilo de trabajo
+ * @return void* Sin uso
+ */
+static void * WorkerThread(void * arguments);
+
+/**
+ * @brief Con la hora virtual las interrupciones no usan el mutex, los relojes no la avanzan
+ *
+ * @param now Sin uso
+ */
+static void FleetClockHook(uint64_t now);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Teclas que reciben pulsaciones, en el orden en que se eligen al azar
+static const fleet_key_t FLEET_KEYS[FLEET_KEYS_COUNT] = {
+    {KEY_F1_GPIO, KEY_F1_BIT},         {KEY_F2_GPIO, KEY_F2_BIT},     {KEY_F3_GPIO, KEY_F3_BIT},
+    {KEY_F4_GPIO, KEY_F4_BIT},         {KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT}, {KEY_CANCEL_GPIO, KEY_CANCEL_BIT},
+};
+
+//! Estado de la flota compartido por los hilos, solo se modifica antes de iniciarlos
+static struct {
+    struct device_s * devices;              //!< Relojes de la flota
+    uint32_t count;                         //!< Cantidad de relojes
+    uint64_t duration;                      //!< Milisegundos simulados de cada reloj
+    struct worker_s workers[FLEET_THREADS_MAX]; //!< Hilos de trabajo
+    uint32_t threads;                       //!< Cantidad de hilos de trabajo
+} fleet[1];
+
+/* === Private function implementation ============================================================================= */
+
+static uint32_t Random(device_t device) {
+    device->random ^= device->random >> 12;
+    device->random ^= device->random << 25;
+    device->random ^= device->random >> 27;
+    return (uint32_t)((device->random * 2685821657736338717ULL) >> 32);
+}
+
+static bool ParseDuration(const char * text, uint64_t * result) {
+    char * end;
+    uint64_t value = strtoull(text, &end, 10);
+
+    if (end == text) {
+        return false;
+    }
+    switch (*end) {
+    case 'd':
+        value *= 24;
+        /* fall through */
+    case 'h':
+        value *= 60;
+        /* fall through */
+    case 'm':
+        value *= 60;
+        /* fall through */
+    case 's':
+        end++;
+        break;
+    }
+    *result = value;
+    return (*end == '\0') && (value > 0);
+}
+
+static bool DeviceCreate(device_t device, uint64_t seed, uint32_t index) {
+    /* Cada reloj tiene su propia secuencia, que no depende del hilo que lo ejecute */
+    device->random = (seed ^ (0x9E3779B97F4A7C15ULL * (index + 1))) | 1;
+    device->drift = (int32_t)(Random(device) % (2 * FLEET_DRIFT_PPM + 1)) - FLEET_DRIFT_PPM;
+    device->press = Random(device) % (2 * FLEET_PRESS_INTERVAL_S * 1000);
+
+    HostContextSelect(&device->context);
+    for (int key = 0; key < FLEET_KEYS_COUNT; key++) {
+        HostGpioSetInput(FLEET_KEYS[key].gpio, FLEET_KEYS[key].bit, true);
+    }
+    device->board = BoardCreate();
+    device->app = AppCreate(device->board);
+    HostContextSelect(NULL);
+    return device->app != NULL;
+}
+
+static void DeviceStep(device_t device) {
+    /* El barrido sigue la frecuencia que la pantalla pide a su temporizador, como en la placa */
+    device->scans += ScreenGetRefreshRate(device->board->screen);
+    while (device->scans >= 1000) {
+        device->scans -= 1000;
+        AppScan(device->app);
+    }
+    if (++device->elapsed >= MS_PER_TICK) {
+        device->elapsed = 0;
+        AppTick(device->app);
+    }
+    AppProcess(device->app);
+}
+
+static void DeviceRun(device_t device) {
+    HostContextSelect(&device->context);
+    for (uint64_t now = 0; now < fleet->duration; now++) {
+        if (now == device->press) {
+            device->key = Random(device) % FLEET_KEYS_COUNT;
+            device->release = now + 1 + Random(device) % FLEET_PRESS_MAX_MS;
+            device->press = device->release + Random(device) % (2 * FLEET_PRESS_INTERVAL_S * 1000);
+            device->presses++;
+            HostGpioSetInput(FLEET_KEYS[device->key].gpio, FLEET_KEYS[device->key].bit, false);
+        } else if (now == device->release) {
+            HostGpioSetInput(FLEET_KEYS[device->key].gpio, FLEET_KEYS[device->key].bit, true);
+        }
+
+        /* El cristal de cada reloj adelanta o atrasa: cada millón de milisegundos corridos suma o saltea uno */
+        device->phase += device->drift;
+        if (device->phase >= PPM) {
+            device->phase -= PPM;
+            DeviceStep(device);
+        } else if (device->phase <= -PPM) {
+            device->phase += PPM;
+            continue;
+        }
+        DeviceStep(device);
+    }
+    HostContextSelect(NULL);
+}
+
+static device_t WorkerTake(worker_t worker) {
+    uint32_t index;
+
+    if (__atomic_load_n(&worker->next, __ATOMIC_RELAXED) >= worker->end) {
+        return NULL;
+    }
+    index = __atomic_fetch_add(&worker->next, 1, __ATOMIC_RELAXED);
+    return (index < worker->end) ? &fleet->devices[index] : NULL;
+}
+
+static void * WorkerThread(void * arguments) {
+    worker_t self = arguments;
+    uint32_t first = (uint32_t)(self - fleet->workers);
+    device_t device;
+
+    /* Primero los relojes propios y después, empezando por el hilo siguiente, los que los demás no alcanzaron */
+    for (uint32_t offset = 0; offset < fleet->threads; offset++) {
+        worker_t victim = &fleet->workers[(first + offset) % fleet->threads];
+        while ((device = WorkerTake(victim)) != NULL) {
+            DeviceRun(device);
+            self->executed++;
+            self->stolen += (offset != 0);
+        }
+    }
+    return NULL;
+}
+
+static void FleetClockHook(uint64_t now) {
+    (void)now;
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(int argc, char * argv[]) {
+    uint32_t count = 64;
+    uint64_t seconds = 3600;
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    uint64_t seed = 1;
+    uint64_t presses = 0;
+    uint64_t writes = 0;
+    struct timespec started, finished;
+    double elapsed;
+    int option;
+
+    while ((option = getopt(argc, argv, "d:t:j:s:")) != -1) {
+        switch (option) {
+        case 'd':
+            count = (uint32_t)strtoul(optarg, NULL, 10);
+            break;
+        case 't':
+            if (!ParseDuration(optarg, &seconds)) {
+                fprintf(stderr, "duración inválida: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'j':
+            threads = strtol(optarg, NULL, 10);
+            break;
+        case 's':
+            seed = strtoull(optarg, NULL, 10);
+            break;
+        default:
+            fprintf(stderr, "uso: %s [-d relojes] [-t duración] [-j hilos] [-s semilla]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if ((count == 0) || (threads < 1) || (threads > FLEET_THREADS_MAX)) {
+        fprintf(stderr, "se necesita al menos un reloj y entre 1 y %d hilos\n", FLEET_THREADS_MAX);
+        return EXIT_FAILURE;
+    }
+
+    fleet->devices = calloc(count, sizeof(struct device_s));
+    if (fleet->devices == NULL) {
+        fprintf(stderr, "no hay memoria para %u relojes\n", count);
+        return EXIT_FAILURE;
+    }
+    fleet->count = count;
+    fleet->duration = seconds * 1000;
+    fleet->threads = (uint32_t)threads;
+
+    /* Los contadores de instancias del firmware no se comparten entre hilos: todos los relojes se crean antes */
+    HostClockUseVirtual(FleetClockHook);
+    for (uint32_t index = 0; index < count; index++) {
+        if (!DeviceCreate(&fleet->devices[index], seed, index)) {
+            fprintf(stderr, "el firmware solo admite %u relojes, se debe compilar con más instancias\n", index);
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (uint32_t index = 0; index < fleet->threads; index++) {
+        fleet->workers[index].next = (uint32_t)(((uint64_t)count * index) / fleet->threads);
+        fleet->workers[index].end = (uint32_t)(((uint64_t)count * (index + 1)) / fleet->threads);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    for (uint32_t index = 0; index < fleet->threads; index++) {
+        if (pthread_create(&fleet->workers[index].thread, NULL, WorkerThread, &fleet->workers[index]) != 0) {
+            fprintf(stderr, "no se pudo crear el hilo %u\n", index);
+            return EXIT_FAILURE;
+        }
+    }
+    for (uint32_t index = 0; index < fleet->threads; index++) {
+        pthread_join(fleet->workers[index].thread, NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+    elapsed = (double)(finished.tv_sec - started.tv_sec) + (double)(finished.tv_nsec - started.tv_nsec) / 1e9;
+
+    for (uint32_t index = 0; index < count; index++) {
+        presses += fleet->devices[index].presses;
+        writes += fleet->devices[index].context.gpio.WRITES;
+    }
+    for (uint32_t index = 0; index < fleet->threads; index++) {
+        printf("hilo %u: %u relojes, %u tomados de otros hilos\n", index, fleet->workers[index].executed,
+               fleet->workers[index].stolen);
+    }
+    printf("%u relojes x %llu s, %llu pulsaciones, %u hilos, %.3f s reales\n", count, (unsigned long long)seconds,
+           (unsigned long long)presses, fleet->threads, elapsed);
+    /* Con la misma semilla las escrituras deben coincidir sin importar la cantidad de hilos */
+    printf("%llu escrituras en los puertos\n", (unsigned long long)writes);
+    printf("%.0f segundos de reloj por segundo real\n", (double)count * (double)seconds / elapsed);
+
+    free(fleet->devices);
+    return EXIT_SUCCESS;
+}
+
+/* === End of documentation ======================================================================================== */
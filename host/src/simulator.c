@@ -0,0 +1,487 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file simulator.c
+ ** @brief Implementación del simulador con hora virtual
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _XOPEN_SOURCE 700 // clock_gettime de POSIX
+
+#include "simulator.h"
+#include "chip.h"
+#include "latency.h"
+#include "load.h"
+#include "profile.h"
+#include "trace.h"
+#include "virtual_board.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define SIMULATOR_LINE_LENGTH 128 //!< Largo máximo de una línea del guion
+
+#define US_PER_MS   1000ULL          //!< Microsegundos en un milisegundo
+#define US_PER_DAY  86400000000ULL   //!< Microsegundos en un día
+
+/* === Private data type declarations ============================================================================== */
+
+/** Comandos del guion */
+typedef enum {
+    COMMAND_PRESS,   //!< Presiona una tecla
+    COMMAND_SHOW,    //!< Muestra el estado
+    COMMAND_WATCH,   //!< Muestra el estado periódicamente
+    COMMAND_EXPECT,  //!< Compara el estado con el esperado
+    COMMAND_LOAD,    //!< Compara la carga máxima del procesador con un presupuesto
+    COMMAND_LATENCY, //!< Compara la latencia máxima de las teclas con un presupuesto
+    COMMAND_TRACE,   //!< Guarda el registro de eventos en un archivo
+    COMMAND_END,     //!< Termina la simulación
+} command_t;
+
+/*! Evento del guion */
+typedef struct event_s {
+    uint64_t time;              //!< Hora del evento en microsegundos
+    command_t command;          //!< Comando a ejecutar
+    uint64_t duration;          //!< Duración de la pulsación, período de watch o latencia admitida, en microsegundos
+    virtual_key_t key;          //!< Tecla de press
+    char digits[VIRTUAL_BOARD_DIGITS + 1]; //!< Dígitos esperados por expect
+    char indicators[5];         //!< Indicadores RGBZ esperados por expect
+    uint16_t budget;            //!< Carga máxima admitida por load, en milésimos
+    char path[32];              //!< Archivo de trace
+    uint16_t line;              //!< Línea del guion, para los mensajes
+} event_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Convierte una hora o una duración del guion en microsegundos
+ *
+ * @param text Texto a convertir, como 1d2h, 30s o 3500ms
+ * @param result Microsegundos
+ * @return true si el texto es válido
+ */
+static bool ParseTime(const char * text, uint64_t * result);
+
+/**
+ * @brief Lee el guion de la entrada estándar
+ *
+ * @return true si el guion es válido, false si se mostró un error
+ */
+static bool ReadScript(void);
+
+/**
+ * @brief Compara un texto esperado con el obtenido, _ es un dígito apagado y * acepta cualquier valor
+ *
+ * @param expected Texto esperado
+ * @param actual Texto obtenido
+ * @return true si coinciden
+ */
+static bool Matches(const char * expected, const char * actual);
+
+/**
+ * @brief Muestra el estado visible del poncho con la hora virtual
+ *
+ * @param now Hora virtual en microsegundos
+ */
+static void Show(uint64_t now);
+
+/**
+ * @brief Ejecuta un evento del guion
+ *
+ * @param event Evento a ejecutar
+ * @param now Hora virtual en microsegundos
+ */
+static void Execute(const event_t * event, uint64_t now);
+
+/**
+ * @brief Guarda el anillo del registro de eventos en un archivo, para decodificarlo con tracedecode
+ *
+ * @param event Evento del guion con el archivo
+ * @return true si el firmware registra eventos y se pudo escribir el archivo
+ */
+static bool SaveTrace(const event_t * event);
+
+/**
+ * @brief Muestra el resumen y termina el programa, con error si falló alguna comparación
+ *
+ * @param now Hora virtual en microsegundos
+ */
+static void Finish(uint64_t now);
+
+/**
+ * @brief Muestra las estadísticas de las regiones medidas del firmware, con el histograma de las duraciones
+ */
+static void ShowProfile(void);
+
+/**
+ * @brief Muestra las latencias medidas de las teclas, con el histograma de la latencia total
+ */
+static void ShowLatency(void);
+
+/**
+ * @brief Aplica los eventos vencidos en cada tick de la hora virtual
+ *
+ * @param now Hora virtual en microsegundos
+ */
+static void SimulatorTick(uint64_t now);
+
+/** Lee el guion y activa la hora virtual al cargar el programa, antes del main() del firmware */
+static void SimulatorConstructor(void) __attribute__((constructor));
+
+/* === Private variable definitions ================================================================================ */
+
+//! Estado del simulador
+static struct {
+    event_t events[SIMULATOR_EVENTS_MAX];   //!< Eventos del guion en orden
+    uint16_t count;                         //!< Cantidad de eventos del guion
+    uint16_t next;                          //!< Próximo evento a ejecutar
+    uint64_t release[VIRTUAL_KEYS_COUNT];   //!< Hora en que se suelta cada tecla, cero si está suelta
+    uint64_t watch;                         //!< Período de watch, cero si está desactivado
+    uint64_t watch_next;                    //!< Hora de la próxima muestra de watch
+    uint32_t expects;                       //!< Comparaciones realizadas
+    uint32_t failures;                      //!< Comparaciones fallidas
+    struct timespec started;                //!< Hora real de inicio de la simulación
+} simulator[1];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool ParseTime(const char * text, uint64_t * result) {
+    static const struct {
+        const char * suffix;
+        uint64_t scale;
+    } UNITS[] = {
+        {"ms", US_PER_MS}, {"d", US_PER_DAY}, {"h", 3600000000ULL}, {"m", 60000000ULL}, {"s", 1000000ULL},
+    };
+    char * end;
+
+    *result = 0;
+    while (*text) {
+        uint64_t value = strtoull(text, &end, 10);
+        uint8_t unit = 0;
+
+        if (end == text) {
+            return false;
+        }
+        while ((unit < sizeof(UNITS) / sizeof(UNITS[0])) &&
+               (strncmp(end, UNITS[unit].suffix, strlen(UNITS[unit].suffix)) != 0)) {
+            unit++;
+        }
+        if (unit == sizeof(UNITS) / sizeof(UNITS[0])) {
+            return false;
+        }
+        *result += value * UNITS[unit].scale;
+        text = end + strlen(UNITS[unit].suffix);
+    }
+    return true;
+}
+
+static bool ReadScript(void) {
+    char line[SIMULATOR_LINE_LENGTH];
+    char when[32], command[16], first[32], second[32];
+    uint16_t number = 0;
+    int fields;
+
+    while (fgets(line, sizeof(line), stdin) != NULL) {
+        event_t * event = &simulator->events[simulator->count];
+        bool valid;
+
+        number++;
+        fields = sscanf(line, " %31s %15s %31s %31s", when, command, first, second);
+        if ((fields <= 0) || (when[0] == '#')) {
+            continue;
+        }
+        if (simulator->count == SIMULATOR_EVENTS_MAX) {
+            fprintf(stderr, "linea %u: el guion tiene mas de %u eventos\n", number, SIMULATOR_EVENTS_MAX);
+            return false;
+        }
+
+        memset(event, 0, sizeof(*event));
+        event->line = number;
+        valid = (fields >= 2) && ParseTime(when, &event->time);
+        if (valid && (strcmp(command, "press") == 0)) {
+            int key = (fields >= 3) ? VirtualBoardFindKey(first) : -1;
+            event->command = COMMAND_PRESS;
+            event->key = key;
+            event->duration = SIMULATOR_CLICK_MS * US_PER_MS;
+            valid = (key >= 0) && ((fields < 4) || ParseTime(second, &event->duration));
+        } else if (valid && (strcmp(command, "show") == 0)) {
+            event->command = COMMAND_SHOW;
+        } else if (valid && (strcmp(command, "watch") == 0)) {
+            event->command = COMMAND_WATCH;
+            valid = (fields >= 3) && ((strcmp(first, "0") == 0) || ParseTime(first, &event->duration));
+        } else if (valid && (strcmp(command, "expect") == 0)) {
+            event->command = COMMAND_EXPECT;
+            if (fields < 4) {
+                strcpy(second, "****");
+            }
+            valid = (fields >= 3) && (strlen(first) == VIRTUAL_BOARD_DIGITS) && (strlen(second) == 4);
+            if (valid) {
+                memcpy(event->digits, first, sizeof(event->digits));
+                memcpy(event->indicators, second, sizeof(event->indicators));
+            }
+        } else if (valid && (strcmp(command, "load") == 0)) {
+            char * end = first;
+            double percent = (fields >= 3) ? strtod(first, &end) : -1.0;
+            event->command = COMMAND_LOAD;
+            event->budget = (uint16_t)(percent * 10.0 + 0.5);
+            valid = (end != first) && ((*end == 0) || (strcmp(end, "%") == 0)) && (percent >= 0.0) && (percent <= 100.0);
+        } else if (valid && (strcmp(command, "latency") == 0)) {
+            event->command = COMMAND_LATENCY;
+            valid = (fields >= 3) && ParseTime(first, &event->duration);
+        } else if (valid && (strcmp(command, "trace") == 0)) {
+            event->command = COMMAND_TRACE;
+            valid = (fields >= 3);
+            if (valid) {
+                memcpy(event->path, first, sizeof(event->path));
+            }
+        } else if (valid && (strcmp(command, "end") == 0)) {
+            event->command = COMMAND_END;
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            fprintf(stderr, "linea %u: evento invalido: %s", number, line);
+            return false;
+        }
+        if ((simulator->count > 0) && (event->time < simulator->events[simulator->count - 1].time)) {
+            fprintf(stderr, "linea %u: los eventos deben estar en orden\n", number);
+            return false;
+        }
+        simulator->count++;
+    }
+    return true;
+}
+
+static bool Matches(const char * expected, const char * actual) {
+    for (; *expected && *actual; expected++, actual++) {
+        char wanted = (*expected == '_') ? ' ' : *expected;
+        if ((wanted != '*') && (wanted != *actual)) {
+            return false;
+        }
+    }
+    return (*expected == 0) && (*actual == 0);
+}
+
+static void Show(uint64_t now) {
+    virtual_board_state_t state;
+    char text[VIRTUAL_BOARD_TEXT_LENGTH];
+    unsigned long long ms = now / US_PER_MS;
+
+    VirtualBoardGetState(&state);
+    VirtualBoardFormat(&state, text, NULL);
+    printf("[%3llud %02llu:%02llu:%02llu.%03llu] %s\n", ms / 86400000ULL, (ms / 3600000ULL) % 24,
+           (ms / 60000ULL) % 60, (ms / 1000ULL) % 60, ms % 1000, text);
+}
+
+static void Execute(const event_t * event, uint64_t now) {
+    virtual_board_state_t state;
+    char text[VIRTUAL_BOARD_TEXT_LENGTH];
+    char digits[VIRTUAL_BOARD_DIGITS + 1];
+    char indicators[5];
+    load_stats_t load;
+    latency_stats_t latency;
+
+    switch (event->command) {
+    case COMMAND_PRESS:
+        VirtualBoardSetKey(event->key, true);
+        simulator->release[event->key] = now + event->duration;
+        break;
+    case COMMAND_SHOW:
+        Show(now);
+        break;
+    case COMMAND_WATCH:
+        simulator->watch = event->duration;
+        simulator->watch_next = now;
+        break;
+    case COMMAND_EXPECT:
+        VirtualBoardGetState(&state);
+        VirtualBoardFormat(&state, text, digits);
+        snprintf(indicators, sizeof(indicators), "%c%c%c%c", state.red ? 'R' : ' ', state.green ? 'G' : ' ',
+                 state.blue ? 'B' : ' ', state.buzzer ? 'Z' : ' ');
+        simulator->expects++;
+        if (!Matches(event->digits, digits) || !Matches(event->indicators, indicators)) {
+            simulator->failures++;
+            printf("linea %u: se esperaba %s %s, ", event->line, event->digits, event->indicators);
+            Show(now);
+        }
+        break;
+    case COMMAND_LOAD:
+        LoadGet(&load);
+        simulator->expects++;
+        if (!LoadWithinBudget(event->budget)) {
+            simulator->failures++;
+            printf("linea %u: carga maxima %.1f %%, se esperaba hasta %.1f %%, ", event->line, load.peak / 10.0,
+                   event->budget / 10.0);
+            Show(now);
+        }
+        break;
+    case COMMAND_LATENCY:
+        LatencyGet(&latency);
+        simulator->expects++;
+        if (!LATENCY_ENABLED) {
+            simulator->failures++;
+            printf("linea %u: el firmware no mide la latencia, se debe compilar con LATENCY=1\n", event->line);
+        } else if (latency.max[LATENCY_SHOWN] > event->duration) {
+            simulator->failures++;
+            printf("linea %u: latencia maxima %.1f ms, se esperaba hasta %.1f ms, ", event->line,
+                   latency.max[LATENCY_SHOWN] / 1000.0, event->duration / 1000.0);
+            Show(now);
+        }
+        break;
+    case COMMAND_TRACE:
+        simulator->expects++;
+        if (!SaveTrace(event)) {
+            simulator->failures++;
+        }
+        break;
+    case COMMAND_END:
+        Finish(now);
+        break;
+    }
+}
+
+static bool SaveTrace(const event_t * event) {
+    const trace_buffer_t * trace = TraceGetBuffer();
+    FILE * file;
+    bool saved;
+
+    if (trace->magic != TRACE_MAGIC) {
+        printf("linea %u: el firmware no registra eventos, se debe compilar con TRACE=1\n", event->line);
+        return false;
+    }
+    file = fopen(event->path, "wb");
+    saved = (file != NULL) && (fwrite(trace, sizeof(*trace), 1, file) == 1);
+    if ((file == NULL) || (fclose(file) != 0)) {
+        saved = false;
+    }
+    if (!saved) {
+        printf("linea %u: no se pudo escribir %s\n", event->line, event->path);
+    }
+    return saved;
+}
+
+static void ShowProfile(void) {
+    profile_stats_t stats;
+
+    for (uint8_t index = 0; ProfileGetStats(index, &stats); index++) {
+        if (index == 0) {
+            printf("%-16s %10s %8s %8s %8s  histograma (ns)\n", "region", "veces", "min", "prom", "max");
+        }
+        printf("%-16s %10u %8u %8u %8u ", stats.name, stats.count, stats.min, stats.mean, stats.max);
+        for (uint8_t bucket = 0; bucket < PROFILE_BUCKETS; bucket++) {
+            if (stats.histogram[bucket] != 0) {
+                printf(" %s%lu:%u", (bucket < PROFILE_BUCKETS - 1) ? "<" : ">=",
+                       1UL << (bucket + PROFILE_BUCKET_SHIFT - (bucket == PROFILE_BUCKETS - 1)), stats.histogram[bucket]);
+            }
+        }
+        printf("\n");
+    }
+}
+
+static void ShowLatency(void) {
+    static const char * const STAGES[LATENCY_STAGES] = {"flanco", "atendida", "publicada", "mostrada"};
+    latency_stats_t stats;
+
+    LatencyGet(&stats);
+    if (stats.count == 0) {
+        return;
+    }
+    printf("latencia de %u pulsaciones, %u descartadas\n", stats.count, stats.discarded);
+    for (uint8_t stage = LATENCY_HANDLED; stage < LATENCY_STAGES; stage++) {
+        printf("  %-10s prom %6.1f ms, max %6.1f ms\n", STAGES[stage], stats.mean[stage] / 1000.0,
+               stats.max[stage] / 1000.0);
+    }
+    printf("  histograma (ms)");
+    for (uint8_t bucket = 0; bucket < LATENCY_BUCKETS; bucket++) {
+        if (stats.histogram[bucket] != 0) {
+            printf(" %s%u:%u", (bucket < LATENCY_BUCKETS - 1) ? "<" : ">=",
+                   (bucket + (bucket < LATENCY_BUCKETS - 1)) * LATENCY_BUCKET_US / 1000, stats.histogram[bucket]);
+        }
+    }
+    printf("\n");
+}
+
+static void Finish(uint64_t now) {
+    struct timespec finished;
+    host_energy_t energy;
+    load_stats_t load;
+    double elapsed;
+    double simulated = (double)now / 1e6;
+
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+    elapsed = (finished.tv_sec - simulator->started.tv_sec) + (finished.tv_nsec - simulator->started.tv_nsec) / 1e9;
+    printf("simulados %.0f s (%.2f dias) en %.2f s, %.0f veces el tiempo real\n", simulated, simulated / 86400.0,
+           elapsed, (elapsed > 0) ? simulated / elapsed : 0.0);
+    printf("comparaciones %u, fallas %u\n", simulator->expects, simulator->failures);
+    ShowProfile();
+    ShowLatency();
+    LoadGet(&load);
+    printf("carga %.1f %% el ultimo segundo, %.1f %% el ultimo minuto, %.1f %% maxima\n", load.second / 10.0,
+           load.minute / 10.0, load.peak / 10.0);
+    HostEnergyGet(&energy);
+    if (energy.elapsed > 0) {
+        printf("nucleo activo %.3f %% (%.1f s), %llu despertares, %.1f J, %.2f mA promedio\n",
+               100.0 * (double)energy.active / (double)energy.elapsed, (double)energy.active / 1e6,
+               (unsigned long long)energy.wakeups, energy.energy / 1e6,
+               energy.energy * 1e6 / HOST_SUPPLY_MV / (double)energy.elapsed);
+    }
+    exit((simulator->failures == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+static void SimulatorTick(uint64_t now) {
+    for (uint8_t key = 0; key < VIRTUAL_KEYS_COUNT; key++) {
+        if ((simulator->release[key] != 0) && (now >= simulator->release[key])) {
+            VirtualBoardSetKey(key, false);
+            simulator->release[key] = 0;
+        }
+    }
+    while ((simulator->next < simulator->count) && (simulator->events[simulator->next].time <= now)) {
+        Execute(&simulator->events[simulator->next++], now);
+    }
+    if ((simulator->watch != 0) && (now >= simulator->watch_next)) {
+        Show(now);
+        simulator->watch_next += simulator->watch;
+    }
+    /* Sin un comando end la simulación termina con el último evento */
+    if (simulator->next == simulator->count) {
+        Finish(now);
+    }
+}
+
+static void SimulatorConstructor(void) {
+    if (!ReadScript()) {
+        exit(EXIT_FAILURE);
+    }
+    setvbuf(stdout, NULL, _IOLBF, 0); // Los resultados se ven a medida que avanza aunque la salida no sea una terminal
+    VirtualBoardReset();
+    HostClockUseVirtual(SimulatorTick);
+    clock_gettime(CLOCK_MONOTONIC, &simulator->started);
+}
+
+/* === Public function implementation ============================================================================== */
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,185 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file tracedecode.c
+ ** @brief Implementación del decodificador del registro binario de eventos
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "tracedecode.h"
+#include "trace.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TRACE_HEADER_SIZE offsetof(trace_buffer_t, records) //!< Bytes de la cabecera del anillo
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Lee la copia del anillo y verifica la cabecera
+ *
+ * @param path Archivo con la copia
+ * @param header Cabecera leída
+ * @return trace_record_t* Registros del anillo, o NULL si se mostró un error
+ */
+static trace_record_t * ReadDump(const char * path, trace_buffer_t * header);
+
+/**
+ * @brief Muestra el nombre de un evento y su dato
+ *
+ * @param record Registro del evento
+ */
+static void ShowEvent(const trace_record_t * record);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Nombres de los eventos, sin acentos como el resto de las salidas de los programas de la PC
+static const char * const NAMES[TRACE_EVENTS_COUNT] = {
+    [TRACE_GAP] = "pausa",
+    [TRACE_ISR_ENTER] = "entra",
+    [TRACE_ISR_EXIT] = "sale",
+    [TRACE_CLOCK_SECOND] = "segundo",
+    [TRACE_ALARM_FIRE] = "alarma suena",
+    [TRACE_ALARM_SNOOZE] = "alarma pospuesta",
+    [TRACE_ALARM_POSTPONE] = "alarma hasta manana",
+    [TRACE_STATE] = "estado",
+    [TRACE_INPUT_ACTIVATED] = "entrada activada",
+    [TRACE_INPUT_DEACTIVATED] = "entrada desactivada",
+};
+
+//! Nombres de las interrupciones
+static const char * const ISRS[] = {
+    [TRACE_ISR_SCAN] = "barrido",
+    [TRACE_ISR_TICK] = "tiempo",
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function implementation ============================================================================= */
+
+static trace_record_t * ReadDump(const char * path, trace_buffer_t * header) {
+    trace_record_t * records = NULL;
+    FILE * file = fopen(path, "rb");
+    bool valid;
+
+    if (file == NULL) {
+        fprintf(stderr, "no se pudo abrir %s\n", path);
+        return NULL;
+    }
+    /* La cantidad de registros sale de la cabecera, el firmware puede usar otro TRACE_RECORDS */
+    valid = (fread(header, TRACE_HEADER_SIZE, 1, file) == 1) && (header->magic == TRACE_MAGIC) &&
+            (header->clock != 0) && (header->capacity != 0);
+    if (valid) {
+        records = malloc(header->capacity * sizeof(trace_record_t));
+        valid = (records != NULL) &&
+                (fread(records, sizeof(trace_record_t), header->capacity, file) == header->capacity);
+    }
+    fclose(file);
+    if (!valid) {
+        fprintf(stderr, "%s no es una copia completa del registro de eventos\n", path);
+        free(records);
+        return NULL;
+    }
+    return records;
+}
+
+static void ShowEvent(const trace_record_t * record) {
+    if (record->event >= TRACE_EVENTS_COUNT) {
+        printf("evento %u dato %u\n", record->event, record->payload);
+        return;
+    }
+    printf("%s", NAMES[record->event]);
+    switch (record->event) {
+    case TRACE_ISR_ENTER:
+    case TRACE_ISR_EXIT:
+        if (record->payload < sizeof(ISRS) / sizeof(ISRS[0])) {
+            printf(" %s", ISRS[record->payload]);
+        } else {
+            printf(" %u", record->payload);
+        }
+        break;
+    case TRACE_CLOCK_SECOND:
+        printf(" :%x%x", record->payload >> 4, record->payload & 0x0F);
+        break;
+    case TRACE_STATE:
+        printf(" %u", record->payload);
+        break;
+    case TRACE_INPUT_ACTIVATED:
+    case TRACE_INPUT_DEACTIVATED:
+        printf(" gpio %u bit %u", record->payload >> 5, record->payload & 0x1F);
+        break;
+    default:
+        break;
+    }
+    printf("\n");
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(int argc, char * argv[]) {
+    trace_buffer_t header;
+    trace_record_t * records;
+    uint32_t first, count;
+    uint64_t time = 0, gap = 0;
+    double unit;
+
+    if (argc != 2) {
+        fprintf(stderr, "uso: %s <archivo>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    records = ReadDump(argv[1], &header);
+    if (records == NULL) {
+        return EXIT_FAILURE;
+    }
+
+    /* Si el anillo dio la vuelta, el registro más antiguo es el que sigue al último escrito */
+    count = (header.written < header.capacity) ? header.written : header.capacity;
+    first = header.written - count;
+    unit = (double)(1UL << header.shift) * 1e6 / header.clock;
+    printf("%u registros de %u escritos, %.3f us por unidad\n", count, header.written, unit);
+    printf("%14s %12s  evento\n", "tiempo (us)", "delta (us)");
+    for (uint32_t index = first; index < header.written; index++) {
+        const trace_record_t * record = &records[index % header.capacity];
+        uint64_t delta = (gap << 16) + record->delta;
+
+        if (record->event == TRACE_GAP) {
+            gap = record->delta;
+            continue;
+        }
+        gap = 0;
+        /* El tiempo del más antiguo se mide desde un registro que ya no está, la línea de tiempo empieza en él */
+        if (index == first) {
+            delta = 0;
+        }
+        time += delta;
+        printf("%14.3f %12.3f  ", time * unit, delta * unit);
+        ShowEvent(record);
+    }
+    free(records);
+    return EXIT_SUCCESS;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,185 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file virtual_board.c
+ ** @brief Implementación de la vista del poncho desde afuera
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "virtual_board.h"
+#include "chip.h"
+#include "poncho.h"
+#include "screen.h"
+#include <stdio.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/*! Pin de una tecla del poncho */
+typedef struct board_key_s {
+    const char * name; //!< Nombre de la tecla
+    uint8_t gpio;      //!< Puerto GPIO de la tecla
+    uint8_t bit;       //!< Bit de la tecla dentro del puerto
+} board_key_t;
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Pines de las teclas, en el orden de virtual_key_t
+static const board_key_t BOARD_KEYS[VIRTUAL_KEYS_COUNT] = {
+    [VIRTUAL_KEY_F1] = {"f1", KEY_F1_GPIO, KEY_F1_BIT},
+    [VIRTUAL_KEY_F2] = {"f2", KEY_F2_GPIO, KEY_F2_BIT},
+    [VIRTUAL_KEY_F3] = {"f3", KEY_F3_GPIO, KEY_F3_BIT},
+    [VIRTUAL_KEY_F4] = {"f4", KEY_F4_GPIO, KEY_F4_BIT},
+    [VIRTUAL_KEY_ACCEPT] = {"accept", KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT},
+    [VIRTUAL_KEY_CANCEL] = {"cancel", KEY_CANCEL_GPIO, KEY_CANCEL_BIT},
+};
+
+//! Imágenes de los dígitos decimales, para convertir la pantalla en texto
+static const uint8_t DIGIT_IMAGES[10] = {
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,
+    SEGMENT_B | SEGMENT_C,
+    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,
+    SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,
+};
+
+//! Reconstrucción de la pantalla multiplexada
+static struct {
+    uint8_t image[VIRTUAL_BOARD_DIGITS]; //!< Segmentos de cada dígito en el barrido en curso
+    uint8_t lit;                         //!< Dígitos encendidos en el barrido en curso
+    uint8_t current;                     //!< Último dígito encendido
+    uint8_t shown[VIRTUAL_BOARD_DIGITS]; //!< Segmentos de cada dígito en el último barrido completo
+} board[1];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+void VirtualBoardReset(void) {
+    for (uint8_t key = 0; key < VIRTUAL_KEYS_COUNT; key++) {
+        VirtualBoardSetKey(key, false);
+    }
+    __disable_irq();
+    memset(board, 0, sizeof(board));
+    __enable_irq();
+}
+
+void VirtualBoardSetKey(virtual_key_t key, bool pressed) {
+    /* Las teclas conectan el pin a masa */
+    if (key < VIRTUAL_KEYS_COUNT) {
+        HostGpioSetInput(BOARD_KEYS[key].gpio, BOARD_KEYS[key].bit, !pressed);
+    }
+}
+
+int VirtualBoardFindKey(const char * name) {
+    for (int key = 0; key < VIRTUAL_KEYS_COUNT; key++) {
+        if (strcmp(BOARD_KEYS[key].name, name) == 0) {
+            return key;
+        }
+    }
+    return -1;
+}
+
+void VirtualBoardGetState(virtual_board_state_t * state) {
+    /* Se copia con las interrupciones bloqueadas para no mezclar dos barridos */
+    __disable_irq();
+    memcpy(state->segments, board->shown, sizeof(state->segments));
+    state->red = !(LPC_GPIO_PORT->PIN[RGB_RED_GPIO] & (1UL << RGB_RED_BIT)); // El LED RGB es activo bajo
+    state->green = !(LPC_GPIO_PORT->PIN[RGB_GREEN_GPIO] & (1UL << RGB_GREEN_BIT));
+    state->blue = !(LPC_GPIO_PORT->PIN[RGB_BLUE_GPIO] & (1UL << RGB_BLUE_BIT));
+    state->buzzer = (LPC_GPIO_PORT->PIN[BUZZER_GPIO] & (1UL << BUZZER_BIT)) != 0;
+    __enable_irq();
+}
+
+void VirtualBoardFormat(const virtual_board_state_t * state, char text[], char digits[]) {
+    size_t length = 0;
+    char symbol;
+
+    for (uint8_t digit = 0; digit < VIRTUAL_BOARD_DIGITS; digit++) {
+        uint8_t segments = state->segments[digit] & ~SEGMENT_P;
+
+        symbol = (segments == 0) ? ' ' : '?';
+        for (uint8_t value = 0; value < sizeof(DIGIT_IMAGES); value++) {
+            if (DIGIT_IMAGES[value] == segments) {
+                symbol = '0' + value;
+            }
+        }
+        if (digits) {
+            digits[digit] = symbol;
+        }
+        text[length++] = symbol;
+        if (state->segments[digit] & SEGMENT_P) {
+            text[length++] = '.';
+        }
+    }
+    if (digits) {
+        digits[VIRTUAL_BOARD_DIGITS] = 0;
+    }
+    snprintf(&text[length], VIRTUAL_BOARD_TEXT_LENGTH - length, "  %c%c%c %c", state->red ? 'R' : '-',
+             state->green ? 'G' : '-', state->blue ? 'B' : '-', state->buzzer ? 'Z' : '-');
+}
+
+void HostGpioWritten(uint8_t port) {
+    uint32_t digits;
+    uint8_t digit;
+    uint8_t segments;
+
+    if ((port != DIGITS_GPIO) && (port != SEGMENTS_GPIO) && (port != SEGMENT_P_GPIO)) {
+        return;
+    }
+
+    /* Solo se toma la imagen cuando hay exactamente un dígito encendido, como lo ve el ojo */
+    digits = LPC_GPIO_PORT->PIN[DIGITS_GPIO] & DIGITS_MASK;
+    if ((digits == 0) || (digits & (digits - 1))) {
+        return;
+    }
+    for (digit = 0; (digits & (1UL << (VIRTUAL_BOARD_DIGITS - 1 - digit))) == 0; digit++) {
+    }
+
+    /* Un dígito que se vuelve a encender cierra el barrido, los que no se encendieron estaban apagados. Las escrituras
+     * en otros pines del puerto con el mismo dígito encendido no son un barrido nuevo. */
+    if ((digit != board->current) && (board->lit & (1 << digit))) {
+        for (uint8_t index = 0; index < VIRTUAL_BOARD_DIGITS; index++) {
+            board->shown[index] = (board->lit & (1 << index)) ? board->image[index] : 0;
+        }
+        board->lit = 0;
+    }
+
+    segments = LPC_GPIO_PORT->PIN[SEGMENTS_GPIO] & SEGMENTS_MASK;
+    if (LPC_GPIO_PORT->PIN[SEGMENT_P_GPIO] & SEGMENT_P_MASK) {
+        segments |= SEGMENT_P;
+    }
+    board->image[digit] = segments;
+    board->lit |= (1 << digit);
+    board->current = digit;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,244 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file virtual_panel.c
+ ** @brief Implementación del panel frontal del poncho en la terminal
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _XOPEN_SOURCE 700 // poll, termios y clock_gettime de POSIX
+
+#include "virtual_panel.h"
+#include "chip.h"
+#include "screen.h"
+#include "virtual_board.h"
+#include "virtual_screen.h"
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/*! Tecla de la terminal asociada a una tecla del poncho */
+typedef struct panel_key_s {
+    char symbol;         //!< Carácter que envía la terminal
+    virtual_key_t key;   //!< Tecla del poncho
+    uint16_t hold_ms;    //!< Tiempo que la tecla queda presionada
+} panel_key_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Hilo que lee la terminal, suelta las teclas vencidas y redibuja el panel
+ *
+ * @param arguments Sin uso
+ * @return void* Nunca retorna
+ */
+static void * PanelThread(void * arguments);
+
+/**
+ * @brief Dibuja la pantalla y el estado de los LEDs y del zumbador si cambiaron desde el último dibujo
+ */
+static void PanelDraw(void);
+
+/**
+ * @brief Devuelve la hora monotónica en milisegundos
+ *
+ * @return uint64_t Milisegundos desde un origen arbitrario
+ */
+static uint64_t PanelNow(void);
+
+/**
+ * @brief Vuelve la terminal al modo en que estaba al iniciar el programa
+ */
+static void PanelRestoreTerminal(void);
+
+/**
+ * @brief Muestra cuánto tiempo estuvo activo el núcleo y la energía que consumió la placa
+ */
+static void PanelReport(void);
+
+/**
+ * @brief Vuelve la terminal al modo original y termina el programa al recibir Ctrl+C
+ *
+ * @param number Número de la señal recibida
+ */
+static void PanelInterrupted(int number);
+
+/** Arranca el panel al cargar el programa, antes del main() del firmware */
+static void PanelConstructor(void) __attribute__((constructor));
+
+/* === Private variable definitions ================================================================================ */
+
+//! Teclas de la terminal, las mayúsculas mantienen presionada la tecla del poncho
+static const panel_key_t PANEL_KEYS[] = {
+    {'t', VIRTUAL_KEY_F1, VIRTUAL_PANEL_CLICK_MS},
+    {'T', VIRTUAL_KEY_F1, VIRTUAL_PANEL_LONG_MS},
+    {'a', VIRTUAL_KEY_F2, VIRTUAL_PANEL_CLICK_MS},
+    {'A', VIRTUAL_KEY_F2, VIRTUAL_PANEL_LONG_MS},
+    {'-', VIRTUAL_KEY_F3, VIRTUAL_PANEL_CLICK_MS},
+    {'_', VIRTUAL_KEY_F3, VIRTUAL_PANEL_HOLD_MS},
+    {'+', VIRTUAL_KEY_F4, VIRTUAL_PANEL_CLICK_MS},
+    {'=', VIRTUAL_KEY_F4, VIRTUAL_PANEL_HOLD_MS},
+    {'\n', VIRTUAL_KEY_ACCEPT, VIRTUAL_PANEL_CLICK_MS},
+    {'x', VIRTUAL_KEY_CANCEL, VIRTUAL_PANEL_CLICK_MS},
+};
+
+#define PANEL_KEYS_COUNT (sizeof(PANEL_KEYS) / sizeof(PANEL_KEYS[0])) //!< Cantidad de teclas de la terminal
+
+//! Estado del panel
+static struct {
+    bool started;                          //!< El hilo del panel ya está en marcha
+    pthread_t thread;                      //!< Hilo que atiende la terminal
+    uint64_t release[PANEL_KEYS_COUNT];    //!< Hora en que se suelta cada tecla, cero si está suelta
+    bool terminal;                         //!< La entrada es una terminal y se cambió su modo
+    struct termios original;               //!< Modo original de la terminal
+    virtual_board_state_t drawn;           //!< Estado del último dibujo
+    bool visible;                          //!< Ya se dibujó el panel al menos una vez
+} panel[1];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint64_t PanelNow(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000;
+}
+
+static void PanelRestoreTerminal(void) {
+    if (panel->terminal) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &panel->original);
+    }
+}
+
+static void PanelReport(void) {
+    host_energy_t energy;
+
+    HostEnergyGet(&energy);
+    if (energy.elapsed > 0) {
+        printf("nucleo activo %.3f %% en %.1f s, %llu despertares, %.3f J\n",
+               100.0 * (double)energy.active / (double)energy.elapsed, (double)energy.elapsed / 1e6,
+               (unsigned long long)energy.wakeups, energy.energy / 1e6);
+    }
+}
+
+static void PanelInterrupted(int number) {
+    (void)number;
+    PanelRestoreTerminal();
+    _exit(EXIT_SUCCESS);
+}
+
+static void PanelDraw(void) {
+    virtual_board_state_t state;
+    virtual_frame_t frame = {0};
+
+    VirtualBoardGetState(&state);
+    if (panel->visible && (memcmp(&state, &panel->drawn, sizeof(state)) == 0)) {
+        return;
+    }
+    if (panel->visible) {
+        fputs("\033[4A", stdout); // Vuelve al principio del dibujo anterior
+    }
+    memcpy(frame.segments, state.segments, sizeof(state.segments));
+    VirtualScreenRender(stdout, &frame);
+    printf("rojo %s  verde %s  azul %s  zumbador %s\033[K\n", state.red ? "*" : "-", state.green ? "*" : "-",
+           state.blue ? "*" : "-", state.buzzer ? "*" : "-");
+    fflush(stdout);
+
+    panel->drawn = state;
+    panel->visible = true;
+}
+
+static void * PanelThread(void * arguments) {
+    struct pollfd input = {.fd = STDIN_FILENO, .events = POLLIN};
+    char symbol;
+
+    (void)arguments;
+    while (true) {
+        if ((poll(&input, (input.fd >= 0) ? 1 : 0, VIRTUAL_PANEL_FRAME_MS) > 0) && (input.revents & POLLIN)) {
+            if (read(STDIN_FILENO, &symbol, 1) != 1) {
+                input.fd = -1; // Fin de la entrada, el panel sigue mostrando la pantalla
+            } else if (symbol == 'q') {
+                PanelReport();
+                exit(EXIT_SUCCESS);
+            }
+            for (uint8_t index = 0; (input.fd >= 0) && (index < PANEL_KEYS_COUNT); index++) {
+                if ((PANEL_KEYS[index].symbol == symbol) && (panel->release[index] == 0)) {
+                    VirtualBoardSetKey(PANEL_KEYS[index].key, true);
+                    panel->release[index] = PanelNow() + PANEL_KEYS[index].hold_ms;
+                }
+            }
+        }
+
+        for (uint8_t index = 0; index < PANEL_KEYS_COUNT; index++) {
+            if ((panel->release[index] != 0) && (PanelNow() >= panel->release[index])) {
+                VirtualBoardSetKey(PANEL_KEYS[index].key, false);
+                panel->release[index] = 0;
+            }
+        }
+        PanelDraw();
+    }
+    return NULL;
+}
+
+static void PanelConstructor(void) {
+    VirtualPanelStart();
+}
+
+/* === Public function implementation ============================================================================== */
+
+void VirtualPanelStart(void) {
+    struct termios raw;
+
+    if (panel->started) {
+        return;
+    }
+    panel->started = true;
+
+    VirtualBoardReset();
+    VirtualScreenInit(VIRTUAL_BOARD_DIGITS);
+
+    /* Sin modo canónico cada tecla llega sin esperar el Enter, y sin eco no ensucia el dibujo */
+    if (isatty(STDIN_FILENO) && (tcgetattr(STDIN_FILENO, &panel->original) == 0)) {
+        raw = panel->original;
+        raw.c_lflag &= ~(ICANON | ECHO);
+        raw.c_cc[VMIN] = 1;
+        raw.c_cc[VTIME] = 0;
+        panel->terminal = (tcsetattr(STDIN_FILENO, TCSANOW, &raw) == 0);
+        atexit(PanelRestoreTerminal);
+        signal(SIGINT, PanelInterrupted);
+        signal(SIGTERM, PanelInterrupted);
+    }
+
+    pthread_create(&panel->thread, NULL, PanelThread, NULL);
+}
+
+/* === End of documentation ======================================================================================== */
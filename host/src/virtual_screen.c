@@ -0,0 +1,203 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file virtual_screen.c
+ ** @brief Implementación del driver de pantalla virtual para la PC
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "virtual_screen.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define NO_DIGIT 0xFF //!< Valor de digit_on cuando todos los dígitos están apagados
+
+/* === Private data type declarations ============================================================================== */
+
+/*! Estado interno de la pantalla virtual */
+struct virtual_screen_s {
+    uint8_t digits;                                //!< Cantidad de dígitos de la pantalla
+    uint32_t now;                                  //!< Hora virtual en microsegundos
+    uint8_t segments;                              //!< Último valor escrito en los segmentos
+    uint8_t digit_on;                              //!< Dígito encendido o NO_DIGIT
+    uint8_t lit;                                   //!< Dígitos encendidos en el cuadro en curso
+    uint8_t image[VIRTUAL_SCREEN_MAX_DIGITS];      //!< Imagen del cuadro en curso
+    uint32_t on_since;                             //!< Hora en que se encendió el dígito actual
+    uint32_t on_time[VIRTUAL_SCREEN_MAX_DIGITS];   //!< Tiempo total encendido de cada dígito
+    uint32_t off_since[VIRTUAL_SCREEN_MAX_DIGITS]; //!< Hora en que se apagó cada dígito
+    uint32_t first_frame;                          //!< Hora en que se completó el primer cuadro
+    virtual_frame_t frames[VIRTUAL_SCREEN_MAX_FRAMES]; //!< Registro circular de cuadros
+    virtual_screen_stats_t stats;                  //!< Estadísticas acumuladas
+};
+
+/* === Private function declarations =============================================================================== */
+
+static void DigitsTurnOff(void);
+
+static void SegmentsUpdate(uint8_t value);
+
+static void DigitTurnOn(uint8_t digit);
+
+/* === Private variable definitions ================================================================================ */
+
+static struct virtual_screen_s screen[1];
+
+static const struct screen_driver_s virtual_driver = {
+    .DigitsTurnOff = DigitsTurnOff,
+    .SegmentsUpdate = SegmentsUpdate,
+    .DigitTurnOn = DigitTurnOn,
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void CloseFrame(void) {
+    virtual_frame_t * frame = &screen->frames[screen->stats.frames % VIRTUAL_SCREEN_MAX_FRAMES];
+
+    frame->timestamp = screen->now;
+    memcpy(frame->segments, screen->image, sizeof(frame->segments));
+    if (screen->stats.frames == 0) {
+        screen->first_frame = screen->now;
+    }
+    screen->stats.frames++;
+    screen->lit = 0;
+}
+
+static void DigitsTurnOff(void) {
+    screen->stats.calls++;
+    if (screen->digit_on != NO_DIGIT) {
+        screen->on_time[screen->digit_on] += screen->now - screen->on_since;
+        screen->off_since[screen->digit_on] = screen->now;
+        screen->digit_on = NO_DIGIT;
+    }
+}
+
+static void SegmentsUpdate(uint8_t value) {
+    screen->stats.calls++;
+    if (screen->digit_on != NO_DIGIT) {
+        screen->stats.ghosting++;
+        screen->image[screen->digit_on] |= value;
+    }
+    screen->segments = value;
+}
+
+static void DigitTurnOn(uint8_t digit) {
+    uint32_t dark;
+
+    screen->stats.calls++;
+    if (digit >= screen->digits) {
+        return;
+    }
+    if (screen->lit & (1 << digit)) {
+        CloseFrame();
+    }
+
+    dark = screen->now - screen->off_since[digit];
+    if (dark > screen->stats.max_dark[digit]) {
+        screen->stats.max_dark[digit] = dark;
+    }
+
+    screen->lit |= (1 << digit);
+    screen->image[digit] = screen->segments;
+    screen->digit_on = digit;
+    screen->on_since = screen->now;
+}
+
+/* === Public function implementation ============================================================================== */
+
+void VirtualScreenInit(uint8_t digits) {
+    memset(screen, 0, sizeof(struct virtual_screen_s));
+    if (digits > VIRTUAL_SCREEN_MAX_DIGITS) {
+        digits = VIRTUAL_SCREEN_MAX_DIGITS;
+    }
+    screen->digits = digits;
+    screen->digit_on = NO_DIGIT;
+}
+
+screen_driver_t VirtualScreenDriver(void) {
+    return &virtual_driver;
+}
+
+void VirtualScreenAdvance(uint32_t microseconds) {
+    screen->now += microseconds;
+}
+
+bool VirtualScreenGetFrame(uint32_t age, virtual_frame_t * frame) {
+    if ((age >= screen->stats.frames) || (age >= VIRTUAL_SCREEN_MAX_FRAMES)) {
+        return false;
+    }
+    memcpy(frame, &screen->frames[(screen->stats.frames - 1 - age) % VIRTUAL_SCREEN_MAX_FRAMES],
+           sizeof(virtual_frame_t));
+    return true;
+}
+
+void VirtualScreenGetStats(virtual_screen_stats_t * stats) {
+    uint32_t elapsed = screen->now;
+    uint32_t on_time;
+
+    memcpy(stats, &screen->stats, sizeof(virtual_screen_stats_t));
+
+    if ((screen->stats.frames > 1) && (screen->now > screen->first_frame)) {
+        stats->refresh_rate = (uint32_t)(((uint64_t)(screen->stats.frames - 1) * 1000000) /
+                                         (screen->frames[(screen->stats.frames - 1) % VIRTUAL_SCREEN_MAX_FRAMES]
+                                              .timestamp - screen->first_frame));
+    }
+
+    for (uint8_t digit = 0; digit < screen->digits; digit++) {
+        on_time = screen->on_time[digit];
+        if (digit == screen->digit_on) {
+            on_time += screen->now - screen->on_since;
+        } else if (screen->now - screen->off_since[digit] > stats->max_dark[digit]) {
+            stats->max_dark[digit] = screen->now - screen->off_since[digit];
+        }
+        if (elapsed > 0) {
+            stats->duty[digit] = (uint16_t)(((uint64_t)on_time * 1000) / elapsed);
+        }
+        if (stats->max_dark[digit] > 1000000 / VIRTUAL_SCREEN_FLICKER_HZ) {
+            stats->flicker = true;
+        }
+    }
+}
+
+void VirtualScreenRender(FILE * output, const virtual_frame_t * frame) {
+    uint8_t segments;
+
+    for (uint8_t digit = 0; digit < screen->digits; digit++) {
+        segments = frame->segments[digit];
+        fprintf(output, " %c  ", (segments & SEGMENT_A) ? '_' : ' ');
+    }
+    fputc('\n', output);
+    for (uint8_t digit = 0; digit < screen->digits; digit++) {
+        segments = frame->segments[digit];
+        fprintf(output, "%c%c%c ", (segments & SEGMENT_F) ? '|' : ' ', (segments & SEGMENT_G) ? '_' : ' ',
+                (segments & SEGMENT_B) ? '|' : ' ');
+    }
+    fputc('\n', output);
+    for (uint8_t digit = 0; digit < screen->digits; digit++) {
+        segments = frame->segments[digit];
+        fprintf(output, "%c%c%c%c", (segments & SEGMENT_E) ? '|' : ' ', (segments & SEGMENT_D) ? '_' : ' ',
+                (segments & SEGMENT_C) ? '|' : ' ', (segments & SEGMENT_P) ? '.' : ' ');
+    }
+    fputc('\n', output);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,151 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef APP_H_
+#define APP_H_
+
+/** @file app.h
+ ** @brief Aplicación del reloj despertador: modos de funcionamiento, ajustes con las teclas y alarma
+ **
+ ** Todo el estado de la aplicación vive en una instancia creada sobre una placa. El firmware crea una sola y la atiende
+ ** desde el programa principal y los temporizadores de barrido y de tiempo; los simuladores de la PC pueden crear
+ ** muchas y atenderlas por separado.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "bsp.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define APP_SCANS_PER_SECOND 1000 //!< Mayor cantidad de llamadas a AppScan() por segundo
+
+#ifndef APP_TICKS_PER_SECOND
+#define APP_TICKS_PER_SECOND 200 //!< Cantidad de llamadas a AppTick() por segundo, un divisor de 1000
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a una instancia de la aplicación
+typedef struct app_s * app_t;
+
+//! Trabajos que la aplicación le pide al programa principal
+typedef enum {
+    APP_WORK_KEYS,   //!< Hay flancos, gestos o un tiempo de espera para AppHandleKeys()
+    APP_WORK_RENDER, //!< Cambió algo de lo que se muestra y hay un cuadro nuevo para AppRender()
+} app_work_t;
+
+/**
+ * @brief Función que pide un trabajo al programa principal, se llama desde AppTick() o desde AppHandleKeys()
+ *
+ * @param context Puntero pasado a AppSetNotify()
+ * @param work Trabajo pedido
+ */
+typedef void (*app_notify_t)(void * context, app_work_t work);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una instancia de la aplicación sobre una placa, con la hora sin configurar
+ *
+ * @param board Placa creada con BoardCreate()
+ * @return app_t Instancia creada, o NULL si ya se usaron las APP_MAX_INSTANCES disponibles
+ */
+app_t AppCreate(board_t board);
+
+/**
+ * @brief Registra la función que avisa al programa principal cuándo hay trabajo para cada manejador
+ *
+ * Sin función registrada la aplicación no avisa nada y los manejadores se deben llamar en cada vuelta.
+ *
+ * @param self Instancia de la aplicación
+ * @param notify Función que recibe los pedidos, o NULL para no avisar
+ * @param context Puntero que se le pasa a la función en cada pedido
+ */
+void AppSetNotify(app_t self, app_notify_t notify, void * context);
+
+/**
+ * @brief Ejecuta juntas AppHandleKeys(), AppHandleAlarm() y AppRender(), para los programas que no las planifican
+ * por separado
+ *
+ * @param self Instancia de la aplicación
+ */
+void AppProcess(app_t self);
+
+/**
+ * @brief Atiende las teclas y el tiempo máximo de inactividad de los ajustes
+ *
+ * Las teclas se leen en AppTick(), que pide APP_WORK_KEYS cuando alguna cambió, algún gesto tiene un evento o se
+ * cumplió el tiempo de inactividad. Alcanza con llamarla después de cada pedido.
+ *
+ * @param self Instancia de la aplicación
+ */
+void AppHandleKeys(app_t self);
+
+/**
+ * @brief Detiene las secuencias del zumbador y del LED cuando la alarma deja de sonar
+ *
+ * @param self Instancia de la aplicación
+ */
+void AppHandleAlarm(app_t self);
+
+/**
+ * @brief Publica un cuadro nuevo en la pantalla si cambió algo de lo que se muestra, si no vuelve enseguida
+ *
+ * Cada cambio pide APP_WORK_RENDER, alcanza con llamarla después de cada pedido.
+ *
+ * @param self Instancia de la aplicación
+ */
+void AppRender(app_t self);
+
+/**
+ * @brief Avanza el barrido de la pantalla, lo único que necesita un ritmo alto y parejo
+ *
+ * En el firmware se llama desde el temporizador de barrido, a la frecuencia que pide la pantalla a través del driver
+ * de la placa y como máximo APP_SCANS_PER_SECOND veces por segundo.
+ *
+ * @param self Instancia de la aplicación
+ */
+void AppScan(app_t self);
+
+/**
+ * @brief Avanza la aplicación un tick: reloj, secuencias de la alarma, lectura de las teclas y tiempos de espera
+ *
+ * Se debe llamar APP_TICKS_PER_SECOND veces por segundo, en el firmware desde el temporizador de tiempo. Puede ser
+ * interrumpida por AppScan(). No escribe en la pantalla: solo pide APP_WORK_RENDER cuando hay un cuadro nuevo.
+ *
+ * @param self Instancia de la aplicación
+ */
+void AppTick(app_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_H_ */
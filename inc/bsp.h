@@ -30,6 +30,7 @@ SPDX-License-Identifier: MIT
 #include <stdbool.h>
 #include "digital.h"
 #include "edu_ciaa.h"
+#include "poncho.h"
 #include "screen.h"
 
 /* === Header for C++ compatibility ================================================================================ */
@@ -47,30 +48,55 @@ extern "C" {
     digital_output_t led_red;
     digital_output_t led_green;
     digital_output_t led_blue;
+    digital_output_group_t leds;
     digital_input_t set_time;
     digital_input_t set_alarm;
     digital_input_t decrement;
     digital_input_t increment;
     digital_input_t accept;
     digital_input_t cancel;
+    digital_input_group_t keys;
     screen_t screen;
  }const * board_t;
+
+//! Función que atiende un temporizador de la placa, se ejecuta dentro de su interrupción
+typedef void (*board_timer_handler_t)(void);
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
 
 /**
  * @brief Inicializa los recursos de hardware del sistema.
- * 
- * @return Board_t 
+ *
+ * @return board_t Placa creada, o NULL si ya se usaron las BOARD_MAX_INSTANCES disponibles.
  */
 board_t BoardCreate(void);
 
 /**
- * @brief Inicializa el temporizador SysTick
- * 
+ * @brief Arranca el temporizador de barrido, el SysTick, con la prioridad más alta
+ *
+ * Es para multiplexar la pantalla, que necesita un ritmo alto y parejo. Su interrupción desplaza a la del
+ * temporizador de tiempo, por lo que el barrido no se atrasa aunque la otra tarde más. La frecuencia la elige la
+ * pantalla de la placa, que la cambia con el contenido y el brillo a través de su driver, hasta la indicada con
+ * ScreenSetTickRate(). Mientras la pantalla está en blanco el temporizador queda detenido.
+ *
+ * @param handler Función que se ejecuta en cada interrupción, debe llamar a ScreenRefresh()
+ */
+void BoardScanTimerStart(board_timer_handler_t handler);
+
+/**
+ * @brief Arranca el temporizador de tiempo, el RIT, con la prioridad más baja
+ *
+ * Es para llevar la hora, leer las teclas y actualizar lo que se muestra, con un ritmo que puede ser mucho menor que
+ * el del barrido. El período se programa en ciclos del reloj del RIT, por lo que no hace falta que la frecuencia
+ * divida a 1000.
+ *
+ * @param ticks Cantidad de interrupciones por segundo, entre uno y la frecuencia del reloj del RIT
+ * @param handler Función que se ejecuta en cada interrupción
+ * @return int 0 si se arrancó el temporizador, -1 si la frecuencia está fuera de rango
  */
-void SysTickInit(uint16_t ticks);
+int BoardTickTimerStart(uint16_t ticks, board_timer_handler_t handler);
 
 /* === End of conditional blocks =================================================================================== */
 
@@ -73,7 +73,7 @@ typedef void (*clock_alarm_callback_t)(clock_t clock);
  * @brief Crea e inicializa una nueva instancia del reloj.
  *
  * @param ticks_per_second Cantidad de ticks necesarios para considerar un segundo completo.
- * @return clock_t Instancia del reloj creada.
+ * @return clock_t Instancia del reloj creada, o NULL si ya se usaron las CLOCK_MAX_INSTANCES disponibles.
  */
 
 clock_t ClockCreate(uint16_t ticks_per_second, clock_alarm_callback_t callback);
@@ -105,8 +105,10 @@ bool ClockSetTime(clock_t clock, const clock_time_t * new_time);
  * Se deben acumular la cantidad de ticks por segundo para que el reloj avance un segundo.
  *
  * @param clock Instancia del reloj.
+ * @return true Si con este tick el reloj avanzó un segundo, y pudo cambiar la hora o empezar a sonar la alarma.
+ * @return false Si todavía no se completó el segundo.
  */
-void ClockNewTick(clock_t clock);
+bool ClockNewTick(clock_t clock);
 
 
 /**
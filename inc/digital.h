@@ -23,7 +23,7 @@ SPDX-License-Identifier: MIT
 /** @file digital.h
  ** @brief Declaraciones del módulo para la gestion de entradas y salidas digitales
  **
- **Esta biblioteca puede usar memoria dinamica o estatica
+ **Los objetos se reservan en memoria estática, la cantidad máxima de cada tipo se configura al compilar
  **/
 
 /* === Headers files inclusions ==================================================================================== */
@@ -38,6 +38,19 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+/**
+ * @brief Cantidad de lecturas consecutivas iguales que necesita una entrada de un grupo para cambiar de estado
+ *
+ * Los contadores verticales del grupo son de dos bits, por lo que el valor es fijo.
+ */
+#define DIGITAL_DEBOUNCE_SAMPLES 4
+
+#ifndef DIGITAL_EVENTS_QUEUE_LENGTH
+#define DIGITAL_EVENTS_QUEUE_LENGTH 16 //!< Cantidad de flancos que se guardan hasta que el programa los consulta
+#endif
+
+#define DIGITAL_EVENTS_CHANNELS 8 //!< Cantidad de canales de interrupción por pin del microcontrolador
+
 /* === Public data type declarations =============================================================================== */
 
 /**
@@ -56,24 +69,67 @@ typedef enum digital_states_e {
  */
 typedef struct digital_output_s * digital_output_t;
 
+/**
+ * @brief Representa un grupo de salidas digitales que se escriben juntas.
+ * 
+ */
+typedef struct digital_output_group_s * digital_output_group_t;
+
+/**
+ * @brief Cantidad de escrituras realizadas y evitadas, para instrumentación.
+ * 
+ */
+typedef struct digital_output_stats_s {
+    uint32_t performed; //!< Cambios de estado escritos en el puerto
+    uint32_t skipped;   //!< Pedidos que no cambiaban el estado y no accedieron al puerto
+} digital_output_stats_t;
+
 /**
  * @brief Representa una entrada digital.
  * 
  */
 typedef struct digital_input_s * digital_input_t;
 
+/**
+ * @brief Representa un grupo de entradas digitales que se leen juntas.
+ * 
+ */
+typedef struct digital_input_group_s * digital_input_group_t;
+
+/**
+ * @brief Función que devuelve la marca de tiempo de los flancos detectados por interrupción.
+ * 
+ */
+typedef uint32_t (*digital_timestamp_t)(void);
+
+/**
+ * @brief Función que avisa, desde la interrupción, que se guardó un flanco en la cola.
+ * 
+ */
+typedef void (*digital_notify_t)(void);
+
+/**
+ * @brief Flanco de una entrada detectado por interrupción.
+ * 
+ */
+typedef struct digital_event_s {
+    digital_input_t input;  //!< Entrada en la que ocurrió el flanco
+    digital_states_t edge;  //!< Tipo de flanco, activación o desactivación
+    uint32_t timestamp;     //!< Marca de tiempo tomada en la interrupción
+} digital_event_t;
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
 /**
  * @brief Funcion para crear una salida digital
  * 
- * Esta funcion crea un objeto de la clase digital. La alocacion de memoria depende de la
- * @ref configuracion de la biblioteca "config"
+ * Esta funcion crea un objeto de la clase digital en memoria estática, se pueden crear hasta DIGITAL_OUTPUTS_MAX
+ * salidas
  * 
  * @param gpio Puerto GPIO a utilizar
  * @param bit  Bit a utilizar dentro del puerto GPIO
- * @return digital_output_t Puntero a la instancia de la salida digital creada
+ * @return digital_output_t Puntero a la instancia de la salida digital creada, NULL si no quedan salidas disponibles
  */
 digital_output_t DigitalOutputCreate(uint8_t gpio, uint8_t bit, bool state);
 
@@ -99,6 +155,65 @@ void DigitalOutputDeactivate(digital_output_t output);
  */
 void DigitalOutputToggle(digital_output_t output);
 
+/**
+ * @brief Función para leer el estado lógico de una salida digital
+ * 
+ * @param output Puntero a la instancia de la salida digital devuelta por la función DigitalOutputCreate()
+ * @return true si la salida está activa
+ */
+bool DigitalOutputGetIsActive(digital_output_t output);
+
+/**
+ * @brief Función para obtener la cantidad de escrituras realizadas y evitadas por una salida digital
+ * 
+ * Cada salida recuerda su estado lógico, por lo que activar una salida activa o desactivar una inactiva no accede al
+ * puerto y cuenta como evitada.
+ * 
+ * @param output Puntero a la instancia de la salida digital
+ * @param stats Puntero donde se copian los contadores
+ */
+void DigitalOutputGetStats(digital_output_t output, digital_output_stats_t * stats);
+
+/**
+ * @brief Función para crear un grupo de salidas digitales
+ * 
+ * Las funciones DigitalOutput* sobre una salida del grupo solo cambian el estado guardado en el grupo. Los cambios se
+ * escriben todos juntos con DigitalOutputGroupUpdate(), con una escritura en los registros de set y clear de cada
+ * puerto que cambió.
+ * 
+ * @return digital_output_group_t Puntero a la instancia del grupo creado
+ */
+digital_output_group_t DigitalOutputGroupCreate(void);
+
+/**
+ * @brief Función para crear una salida digital dentro de un grupo
+ * 
+ * @param group Puntero al grupo devuelto por la función DigitalOutputGroupCreate()
+ * @param gpio Puerto GPIO a utilizar
+ * @param bit Bit a utilizar dentro del puerto GPIO
+ * @param state Nivel del pin con la salida inactiva
+ * @return digital_output_t Puntero a la salida creada, NULL si el grupo ya usa la cantidad máxima de puertos
+ */
+digital_output_t DigitalOutputGroupAdd(digital_output_group_t group, uint8_t gpio, uint8_t bit, bool state);
+
+/**
+ * @brief Función para escribir en los puertos los cambios pendientes de las salidas de un grupo
+ * 
+ * @param group Puntero al grupo devuelto por la función DigitalOutputGroupCreate()
+ */
+void DigitalOutputGroupUpdate(digital_output_group_t group);
+
+/**
+ * @brief Función para obtener la cantidad de escrituras realizadas y evitadas por un grupo de salidas
+ * 
+ * Cuenta una escritura realizada por cada puerto con cambios en una actualización, y una evitada por cada puerto sin
+ * cambios.
+ * 
+ * @param group Puntero al grupo devuelto por la función DigitalOutputGroupCreate()
+ * @param stats Puntero donde se copian los contadores
+ */
+void DigitalOutputGroupGetStats(digital_output_group_t group, digital_output_stats_t * stats);
+
 /**
  * @brief Función para crear una entrada digital
  * 
@@ -140,13 +255,103 @@ bool DigitalInputWasDeactivated(digital_input_t input);
 /**
  * @brief Indica si el estado de una entrada digital ha cambiado
  * 
- * Esta función verifica si el estado de la entrada digital ha cambiado desde la última consulta
+ * Esta función verifica si el estado de la entrada digital ha cambiado desde la última consulta. En una entrada de un
+ * grupo que se activó y se desactivó entre dos consultas, cada consulta informa uno de los flancos en el orden en que
+ * ocurrieron.
  * 
  * @param input Puntero a la instancia de la entrada digital devuelto por la función DigitalInputCreate()
  * @return enum digital_states_e Estado del cambio: activada, desactivada o sin cambios
  */
 enum digital_states_e DigitalInputWasChanged(digital_input_t input);
 
+/**
+ * @brief Función para crear un grupo de entradas digitales
+ * 
+ * Las entradas de un grupo se leen todas juntas con DigitalInputGroupScan(), que lee una sola vez cada puerto GPIO
+ * involucrado y calcula los cambios de todas las entradas con operaciones de bits. Las funciones DigitalInput* sobre
+ * una entrada del grupo consultan el resultado de la última lectura sin acceder al hardware.
+ * 
+ * @return digital_input_group_t Puntero a la instancia del grupo creado
+ */
+digital_input_group_t DigitalInputGroupCreate(void);
+
+/**
+ * @brief Función para crear una entrada digital dentro de un grupo
+ * 
+ * @param group Puntero al grupo devuelto por la función DigitalInputGroupCreate()
+ * @param gpio Puerto GPIO a utilizar
+ * @param bit Bit a utilizar dentro del puerto GPIO
+ * @param inverted Indica si la entrada digital es invertida o no
+ * @return digital_input_t Puntero a la entrada creada, NULL si el grupo ya usa la cantidad máxima de puertos
+ */
+digital_input_t DigitalInputGroupAdd(digital_input_group_t group, uint8_t gpio, uint8_t bit, bool inverted);
+
+/**
+ * @brief Función para leer y filtrar todas las entradas de un grupo
+ * 
+ * Cada pin tiene un contador de dos bits guardado en forma vertical: el bit bajo de los contadores de todos los pines
+ * de un puerto está en una palabra y el bit alto en otra. Así todas las entradas se filtran en paralelo con unas pocas
+ * operaciones de bits. Una entrada cambia de estado cuando su pin lee el nuevo nivel en @ref DIGITAL_DEBOUNCE_SAMPLES
+ * llamadas consecutivas; cualquier lectura con el nivel anterior reinicia la cuenta.
+ * 
+ * Está pensada para llamarse a intervalos fijos desde la interrupción del temporizador, de forma que el tiempo de
+ * filtrado sea determinista. Los flancos detectados quedan pendientes hasta que se consultan con
+ * DigitalInputWasActivated(), DigitalInputWasDeactivated() o DigitalInputWasChanged(), que son seguras de llamar desde
+ * el programa principal mientras la interrupción lee el grupo.
+ * 
+ * @param group Puntero al grupo devuelto por la función DigitalInputGroupCreate()
+ * @return true si alguna entrada cambió de estado en esta lectura
+ */
+bool DigitalInputGroupScan(digital_input_group_t group);
+
+/**
+ * @brief Indica si alguna entrada del grupo tiene un flanco pendiente de consultar
+ * 
+ * @param group Puntero al grupo devuelto por la función DigitalInputGroupCreate()
+ * @return true si hay al menos un flanco pendiente, false en caso contrario
+ */
+bool DigitalInputGroupWasChanged(digital_input_group_t group);
+
+/**
+ * @brief Función para inicializar la detección de flancos por interrupción
+ * 
+ * Libera todos los canales, descarta los flancos pendientes y configura la marca de tiempo de los próximos.
+ * 
+ * @param timestamp Función llamada desde la interrupción para obtener la marca de tiempo, NULL para no usarla
+ * @param notify Función llamada desde la interrupción después de guardar cada flanco, NULL para no usarla
+ */
+void DigitalEventsInit(digital_timestamp_t timestamp, digital_notify_t notify);
+
+/**
+ * @brief Función para detectar por interrupción los flancos de una entrada
+ * 
+ * Asigna a la entrada un canal de interrupción por pin configurado para ambos flancos. Cada flanco se guarda en una
+ * cola con su marca de tiempo, sin esperar a que el programa principal consulte la entrada. Los flancos se informan
+ * sin filtrar los rebotes.
+ * 
+ * @param input Puntero a la entrada digital, individual o dentro de un grupo
+ * @param channel Canal de interrupción por pin a utilizar, menor que @ref DIGITAL_EVENTS_CHANNELS
+ * @return int 0 si se configuró la interrupción, -1 si el canal no es válido o ya está en uso
+ */
+int DigitalInputEnableEvents(digital_input_t input, uint8_t channel);
+
+/**
+ * @brief Indica si hay flancos detectados por interrupción pendientes de consultar
+ * 
+ * @return true si hay al menos un flanco en la cola
+ */
+bool DigitalEventsPending(void);
+
+/**
+ * @brief Función para obtener el flanco más antiguo detectado por interrupción
+ * 
+ * Puede llamarse desde el programa principal mientras las interrupciones agregan flancos a la cola.
+ * 
+ * @param event Puntero donde se copia el flanco
+ * @return true si se obtuvo un flanco, false si la cola estaba vacía
+ */
+bool DigitalEventGet(digital_event_t * event);
+
 /* === End of conditional blocks =================================================================================== */
 #ifdef __cplusplus
 }
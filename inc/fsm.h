@@ -0,0 +1,134 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef FSM_H_
+#define FSM_H_
+
+/** @file fsm.h
+ ** @brief Máquina de estados dirigida por una tabla constante de estados y eventos
+ **
+ ** La tabla tiene una fila por estado y una columna por evento. Cada celda indica la acción que se ejecuta y el estado
+ ** siguiente, por lo que atender un evento es indexar la tabla sin recorrer condiciones. Primero se ejecuta la acción,
+ ** que puede elegir el estado siguiente, y si el estado cambia, la salida del anterior y la entrada del nuevo. Las
+ ** celdas que no se inicializan quedan en cero e ignoran el evento, así la tabla se declara solo con las transiciones
+ ** que existen:
+ **
+ **     static const fsm_transition_t TRANSITIONS[STATES][EVENTS] = {
+ **         [IDLE] = {[EVENT_START] = {StartMotor, RUNNING}},
+ **         [RUNNING] = {[EVENT_STOP] = {StopMotor, IDLE}, [EVENT_FASTER] = {SpeedUp, FSM_STAY}},
+ **     };
+ **
+ ** El estado cero está reservado para @ref FSM_STAY, los estados de la aplicación empiezan en uno.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define FSM_STAY 0 //!< Estado siguiente de las transiciones internas, que no ejecutan la salida ni la entrada
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Acción de entrada o de salida de un estado
+ *
+ * @param context Contexto indicado al crear la máquina
+ */
+typedef void (*fsm_hook_t)(void * context);
+
+/**
+ * @brief Acción de una transición, puede elegir otro estado siguiente para las transiciones condicionales
+ *
+ * @param context Contexto indicado al crear la máquina
+ * @param next Estado siguiente según la tabla
+ * @return uint8_t Estado siguiente, normalmente next, o @ref FSM_STAY para no cambiar de estado
+ */
+typedef uint8_t (*fsm_action_t)(void * context, uint8_t next);
+
+//! Celda de la tabla: qué se hace al recibir un evento en un estado
+typedef struct fsm_transition_s {
+    fsm_action_t action; //!< Acción de la transición, NULL si no hay
+    uint8_t next;        //!< Estado siguiente, @ref FSM_STAY si la transición es interna o no existe
+} fsm_transition_t;
+
+//! Acciones que se ejecutan al entrar y al salir de un estado
+typedef struct fsm_state_s {
+    fsm_hook_t entry; //!< Acción al entrar, NULL si no hay
+    fsm_hook_t exit;  //!< Acción al salir, NULL si no hay
+} fsm_state_t;
+
+/**
+ * @brief Definición completa de una máquina, pensada para declararse constante y quedar en la memoria flash
+ *
+ */
+typedef struct fsm_table_s {
+    const fsm_state_t * states;           //!< Acciones de cada estado, indexadas por el número de estado
+    const fsm_transition_t * transitions; //!< Matriz de states_count filas por events_count columnas
+    uint8_t states_count;                 //!< Cantidad de estados, incluido @ref FSM_STAY
+    uint8_t events_count;                 //!< Cantidad de eventos
+} const * fsm_table_t;
+
+//! Referencia a una máquina de estados
+typedef struct fsm_s * fsm_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una máquina de estados y entra en el estado inicial
+ *
+ * @param table Definición de la máquina
+ * @param initial Estado inicial, se ejecuta su acción de entrada
+ * @param context Contexto que reciben todas las acciones, normalmente la instancia dueña de la máquina
+ * @return fsm_t Máquina creada, o NULL si ya se usaron las FSM_MAX_INSTANCES disponibles
+ */
+fsm_t FsmCreate(fsm_table_t table, uint8_t initial, void * context);
+
+/**
+ * @brief Atiende un evento según la tabla
+ *
+ * @param self Máquina que recibe el evento
+ * @param event Evento recibido, los que están fuera de la tabla se ignoran
+ */
+void FsmDispatch(fsm_t self, uint8_t event);
+
+/**
+ * @brief Consulta el estado actual
+ *
+ * @param self Máquina a consultar
+ * @return uint8_t Estado actual
+ */
+uint8_t FsmGetState(fsm_t self);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FSM_H_ */
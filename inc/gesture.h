@@ -0,0 +1,131 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef GESTURE_H_
+#define GESTURE_H_
+
+/** @file gesture.h
+ ** @brief Declaraciones del módulo que reconoce gestos (clic, doble clic, presión larga y repetición) sobre una tecla
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "digital.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef GESTURE_QUEUE_LENGTH
+#define GESTURE_QUEUE_LENGTH 4 //!< Cantidad de eventos que se guardan hasta que el programa los consulta
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Eventos que informa el reconocedor de gestos.
+ *
+ */
+typedef enum gesture_event_e {
+    GESTURE_NONE = 0,     //!< No hay eventos pendientes
+    GESTURE_CLICK,        //!< Presión corta, informada al soltar la tecla
+    GESTURE_DOUBLE_CLICK, //!< Dos presiones cortas separadas por menos del tiempo configurado
+    GESTURE_LONG_PRESS,   //!< La tecla se mantuvo presionada el tiempo configurado
+    GESTURE_REPEAT,       //!< Repetición periódica mientras la tecla sigue presionada
+} gesture_event_t;
+
+/**
+ * @brief Configuración de los gestos que reconoce una tecla. Un tiempo en cero deshabilita el gesto.
+ *
+ */
+typedef struct gesture_config_s {
+    uint16_t double_click_ms;   //!< Tiempo máximo entre dos clics para informar un doble clic (ms)
+    uint16_t long_press_ms;     //!< Tiempo de presión para informar una presión larga (ms)
+    uint16_t repeat_delay_ms;   //!< Tiempo de presión hasta la primera repetición (ms)
+    uint16_t repeat_period_ms;  //!< Intervalo inicial entre repeticiones (ms)
+    uint16_t repeat_min_ms;     //!< Intervalo mínimo entre repeticiones al terminar de acelerar (ms)
+    uint16_t repeat_step_ms;    //!< Reducción del intervalo después de cada repetición (ms)
+} const * gesture_config_t;
+
+/**
+ * @brief Representa el reconocedor de gestos de una tecla.
+ *
+ */
+typedef struct gesture_s * gesture_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función para crear el reconocedor de gestos de una tecla
+ *
+ * La tecla se considera presionada mientras la entrada está activa. Cuando un doble clic está habilitado el clic
+ * simple se informa recién al vencer el tiempo de espera del segundo clic; si está deshabilitado se informa al soltar.
+ * Una presión que generó una presión larga o repeticiones no genera clic al soltarse.
+ *
+ * @param input Entrada digital de la tecla
+ * @param config Configuración de los gestos, debe permanecer válida mientras se use el reconocedor
+ * @return gesture_t Puntero al reconocedor creado
+ */
+gesture_t GestureCreate(digital_input_t input, gesture_config_t config);
+
+/**
+ * @brief Función para avanzar el reconocedor de gestos
+ *
+ * Se llama a intervalos regulares, normalmente desde la interrupción del temporizador después de leer las teclas.
+ *
+ * @param gesture Puntero al reconocedor devuelto por la función GestureCreate()
+ * @param elapsed_ms Tiempo transcurrido desde la llamada anterior (ms)
+ */
+void GestureTick(gesture_t gesture, uint16_t elapsed_ms);
+
+/**
+ * @brief Función para obtener el siguiente evento pendiente
+ *
+ * Puede llamarse desde el programa principal mientras la interrupción avanza el reconocedor.
+ *
+ * @param gesture Puntero al reconocedor devuelto por la función GestureCreate()
+ * @return gesture_event_t Evento más antiguo sin consultar, GESTURE_NONE si no hay ninguno
+ */
+gesture_event_t GestureGetEvent(gesture_t gesture);
+
+/**
+ * @brief Indica si hay eventos pendientes sin consumirlos
+ *
+ * Permite que la interrupción avise al programa principal solo cuando hay gestos para atender.
+ *
+ * @param gesture Puntero al reconocedor devuelto por la función GestureCreate()
+ * @return true si GestureGetEvent() devolvería un evento
+ */
+bool GestureHasEvent(gesture_t gesture);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GESTURE_H_ */
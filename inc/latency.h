@@ -0,0 +1,159 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef LATENCY_H_
+#define LATENCY_H_
+
+/** @file latency.h
+ ** @brief Medición de la latencia desde que se presiona una tecla hasta que la pantalla muestra la respuesta
+ **
+ ** Cada medición recorre cuatro etapas y guarda el instante de cada una: el flanco físico de la tecla, tomado por la
+ ** interrupción por pin antes de filtrar los rebotes, el comienzo del manejador del evento, la publicación de un cuadro
+ ** que cambia algún dígito y el primer barrido que enciende uno de los dígitos cambiados. Las marcas que llegan fuera
+ ** de orden se ignoran, de modo que los cambios de la pantalla que no responden a una tecla no se miden.
+ **
+ ** Una medición se descarta si el evento no cambió la pantalla, como una pulsación que el modo actual ignora, o si
+ ** tardó más de LATENCY_TIMEOUT_US, como una pulsación larga que se atiende al cumplir su duración. De las completas se
+ ** guardan el promedio y el máximo de cada etapa, y un histograma de la latencia total para comparar los cambios de la
+ ** interfaz con un presupuesto en el simulador.
+ **
+ ** En el microcontrolador el tiempo se cuenta con el CYCCNT de la unidad DWT del Cortex-M4; en la PC, con el modelo del
+ ** núcleo de HostCoreCycles().
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef LATENCY_ENABLED
+#define LATENCY_ENABLED 0 //!< Uno para medir la latencia de las teclas, cero para quitar la medición del firmware
+#endif
+
+#ifndef LATENCY_TIMEOUT_US
+#define LATENCY_TIMEOUT_US 100000 //!< Tiempo máximo desde el flanco para completar una medición, en microsegundos
+#endif
+
+#define LATENCY_BUCKETS 16 //!< Cantidad de barras del histograma, la última cuenta las que superan a las anteriores
+
+#ifndef LATENCY_BUCKET_US
+#define LATENCY_BUCKET_US 2000 //!< Ancho de cada barra del histograma, en microsegundos
+#endif
+
+#if LATENCY_ENABLED
+/** Habilita el contador de ciclos y borra las mediciones, se llama una vez al arrancar */
+#define LATENCY_INIT() LatencyInit()
+
+/** Empieza una medición con el instante de un flanco físico */
+#define LATENCY_EDGE(timestamp) LatencyEdge(timestamp)
+
+/** Marca una etapa de la medición en curso */
+#define LATENCY_MARK(stage) LatencyMark(stage)
+
+/** Indica que el programa terminó de responder a los eventos atendidos */
+#define LATENCY_SETTLE() LatencySettle()
+#else
+#define LATENCY_INIT()          ((void)0)
+#define LATENCY_EDGE(timestamp) ((void)0)
+#define LATENCY_MARK(stage)     ((void)0)
+#define LATENCY_SETTLE()        ((void)0)
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Etapas de una medición, en el orden en que deben ocurrir
+typedef enum {
+    LATENCY_EDGE,      //!< Flanco físico de la tecla
+    LATENCY_HANDLED,   //!< Comienzo del manejador del evento de la tecla
+    LATENCY_PUBLISHED, //!< Publicación de un cuadro que cambia algún dígito
+    LATENCY_SHOWN,     //!< Primer barrido de un dígito cambiado, completa la medición
+    LATENCY_STAGES,    //!< Cantidad de etapas
+} latency_stage_t;
+
+//! Resultados de las mediciones, los tiempos en microsegundos desde el flanco
+typedef struct latency_stats_s {
+    uint32_t count;                      //!< Mediciones completas
+    uint32_t discarded;                  //!< Mediciones descartadas por no cambiar la pantalla o por demorar
+    uint32_t mean[LATENCY_STAGES];       //!< Tiempo promedio hasta cada etapa
+    uint32_t max[LATENCY_STAGES];        //!< Tiempo máximo hasta cada etapa
+    uint32_t histogram[LATENCY_BUCKETS]; //!< Mediciones completas según la latencia total
+} latency_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Habilita el contador de ciclos del núcleo y borra las mediciones
+ */
+void LatencyInit(void);
+
+/**
+ * @brief Lee el contador de ciclos del núcleo, sirve como marca de tiempo de los flancos de DigitalEventsInit()
+ *
+ * @return uint32_t Ciclos desde un origen arbitrario
+ */
+uint32_t LatencyNow(void);
+
+/**
+ * @brief Empieza una medición, salvo que haya otra en curso que todavía no venció
+ *
+ * Los rebotes de una pulsación no reinician la medición, que se cuenta desde el primer flanco.
+ *
+ * @param timestamp Instante del flanco, obtenido con LatencyNow()
+ */
+void LatencyEdge(uint32_t timestamp);
+
+/**
+ * @brief Marca una etapa de la medición en curso, se llama desde el programa principal y desde las interrupciones
+ *
+ * La marca se ignora si la etapa anterior no se marcó. Al marcar LATENCY_SHOWN la medición se completa y se suma a las
+ * estadísticas.
+ *
+ * @param stage Etapa alcanzada
+ */
+void LatencyMark(latency_stage_t stage);
+
+/**
+ * @brief Descarta la medición en curso si su evento ya se atendió sin publicar un cuadro distinto
+ */
+void LatencySettle(void);
+
+/**
+ * @brief Consulta los resultados de las mediciones
+ *
+ * @param stats Resultados de las mediciones completas
+ */
+void LatencyGet(latency_stats_t * stats);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LATENCY_H_ */
@@ -0,0 +1,114 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef LOAD_H_
+#define LOAD_H_
+
+/** @file load.h
+ ** @brief Medición de la carga del procesador a partir del tiempo que el programa principal pasa dormido
+ **
+ ** El programa principal duerme con LoadSleep(), que cuenta los ciclos del núcleo entre que se bloquean las
+ ** interrupciones y que __WFI() despierta, antes de que se ejecute el manejador que lo despertó. El temporizador de
+ ** tiempo llama a LoadTick() en cada tick y al completar un segundo la carga es la parte de ese segundo que el núcleo
+ ** no estuvo dormido. Se guardan la carga del último segundo, el promedio del último minuto y el máximo desde que se
+ ** borró, todas en milésimos, para comparar con un presupuesto antes de agregar trabajo a las interrupciones.
+ **
+ ** En el microcontrolador los ciclos se cuentan con el CYCCNT de la unidad DWT del Cortex-M4; en la PC, con el modelo
+ ** del núcleo de HostCoreCycles().
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef LOAD_BUDGET
+#define LOAD_BUDGET 500 //!< Carga máxima admitida, en milésimos, para LoadWithinBudget()
+#endif
+
+#define LOAD_FULL 1000 //!< Carga con el núcleo siempre ejecutando, en milésimos
+
+#define LOAD_MINUTE_SECONDS 60 //!< Cantidad de segundos promediados en la carga del último minuto
+
+/* === Public data type declarations =============================================================================== */
+
+//! Cargas del procesador, en milésimos del tiempo
+typedef struct load_stats_s {
+    uint16_t second;  //!< Carga del último segundo completo
+    uint16_t minute;  //!< Promedio de los segundos completos del último minuto
+    uint16_t peak;    //!< Carga del segundo más cargado desde el arranque o desde LoadResetPeak()
+    uint32_t seconds; //!< Cantidad de segundos medidos desde el arranque
+} load_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Habilita el contador de ciclos del núcleo y empieza a medir
+ *
+ * @param ticks_per_second Cantidad de llamadas a LoadTick() en un segundo
+ */
+void LoadInit(uint16_t ticks_per_second);
+
+/**
+ * @brief Duerme hasta la próxima interrupción y cuenta el tiempo dormido, reemplaza a __WFI() en el programa principal
+ */
+void LoadSleep(void);
+
+/**
+ * @brief Cuenta un tick y calcula la carga al completar cada segundo, se llama desde el temporizador de tiempo
+ */
+void LoadTick(void);
+
+/**
+ * @brief Consulta las cargas medidas
+ *
+ * @param stats Cargas del último segundo, del último minuto y máxima
+ */
+void LoadGet(load_stats_t * stats);
+
+/**
+ * @brief Borra la carga máxima para volver a medirla desde ahora
+ */
+void LoadResetPeak(void);
+
+/**
+ * @brief Indica si la carga máxima medida está dentro del presupuesto
+ *
+ * @param budget Carga máxima admitida, en milésimos, normalmente LOAD_BUDGET
+ * @return true si ningún segundo superó el presupuesto
+ */
+bool LoadWithinBudget(uint16_t budget);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOAD_H_ */
@@ -0,0 +1,141 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef PATTERN_H_
+#define PATTERN_H_
+
+/** @file pattern.h
+ ** @brief Declaraciones del módulo que reproduce secuencias de encendido y apagado sobre una salida digital
+ **
+ ** Una secuencia es una tabla constante de pasos, cada uno con una duración y un ciclo de trabajo. El reproductor
+ ** avanza un tick por llamada a PatternTick(), modulando la salida por software dentro de cada paso, por lo que el mismo
+ ** mecanismo sirve para pitidos, volumen creciente en el zumbador o una respiración lenta en un LED.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "digital.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef PATTERN_TICKS_PER_SECOND
+#define PATTERN_TICKS_PER_SECOND 200 //!< Llamadas a PatternTick() por segundo, base de las secuencias incluidas
+#endif
+
+#ifndef PATTERN_DUTY_MAX
+#define PATTERN_DUTY_MAX 4 //!< Ciclo de trabajo de un paso siempre encendido y período de la modulación en ticks
+#endif
+
+#define PATTERN_FOREVER 0 //!< Cantidad de repeticiones de una secuencia que se repite hasta detenerla
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Paso de una secuencia.
+ *
+ */
+typedef struct pattern_step_s {
+    uint16_t duration; //!< Duración del paso en ticks
+    uint8_t duty;      //!< Ticks encendida en cada período de modulación, de 0 a @ref PATTERN_DUTY_MAX
+} pattern_step_t;
+
+/**
+ * @brief Secuencia de pasos, pensada para declararse constante y quedar en la memoria flash.
+ *
+ */
+typedef struct pattern_s {
+    const pattern_step_t * steps; //!< Tabla de pasos de la secuencia
+    uint8_t length;               //!< Cantidad de pasos de la tabla
+    uint8_t repeat;               //!< Cantidad de veces que se reproduce, @ref PATTERN_FOREVER para no terminar nunca
+    const struct pattern_s * next; //!< Secuencia que se reproduce al terminar, NULL para apagar la salida
+} const * pattern_t;
+
+/**
+ * @brief Representa un reproductor de secuencias sobre una salida digital.
+ *
+ */
+typedef struct pattern_player_s * pattern_player_t;
+
+/* === Public variable declarations ================================================================================ */
+
+extern const struct pattern_s PATTERN_BEEP_BEEP;   //!< Dos pitidos cortos y una pausa, sin terminar nunca
+extern const struct pattern_s PATTERN_ESCALATING;  //!< Pitidos dobles cada vez más fuertes, luego PATTERN_BEEP_BEEP
+extern const struct pattern_s PATTERN_BREATHE;     //!< Encendido y apagado gradual con un período de dos segundos
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Función para crear un reproductor de secuencias
+ *
+ * @param output Salida digital sobre la que se reproducen las secuencias
+ * @return pattern_player_t Puntero al reproductor creado
+ */
+pattern_player_t PatternPlayerCreate(digital_output_t output);
+
+/**
+ * @brief Función para empezar a reproducir una secuencia desde el primer paso
+ *
+ * Solo inicializa el estado del reproductor, su costo no depende de la secuencia. Puede llamarse desde una
+ * interrupción, reemplaza a la secuencia que se estaba reproduciendo.
+ *
+ * @param player Puntero al reproductor devuelto por la función PatternPlayerCreate()
+ * @param pattern Secuencia a reproducir
+ */
+void PatternPlay(pattern_player_t player, pattern_t pattern);
+
+/**
+ * @brief Función para detener la secuencia en reproducción y apagar la salida
+ *
+ * @param player Puntero al reproductor devuelto por la función PatternPlayerCreate()
+ */
+void PatternStop(pattern_player_t player);
+
+/**
+ * @brief Indica si el reproductor tiene una secuencia en reproducción
+ *
+ * @param player Puntero al reproductor devuelto por la función PatternPlayerCreate()
+ * @return true si hay una secuencia en reproducción
+ */
+bool PatternIsPlaying(pattern_player_t player);
+
+/**
+ * @brief Función para avanzar la reproducción un tick, se llama desde la interrupción del temporizador
+ *
+ * Se debe llamar PATTERN_TICKS_PER_SECOND veces por segundo para que las secuencias incluidas duren lo indicado. La
+ * modulación tiene un período de PATTERN_DUTY_MAX ticks, 50 Hz con los valores predeterminados.
+ *
+ * @param player Puntero al reproductor devuelto por la función PatternPlayerCreate()
+ */
+void PatternTick(pattern_player_t player);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PATTERN_H_ */
@@ -0,0 +1,142 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+/** @file profile.h
+ ** @brief Medición del tiempo de ejecución de regiones del código, con mínimo, máximo, promedio e histograma
+ **
+ ** Cada región se marca con PROFILE_BEGIN() y PROFILE_END() con el mismo nombre, dentro de una misma función:
+ **
+ **     PROFILE_BEGIN(refresh);
+ **     ScreenRefresh(screen);
+ **     PROFILE_END(refresh);
+ **
+ ** En el microcontrolador el tiempo se mide en ciclos del núcleo con el contador CYCCNT de la unidad DWT del
+ ** Cortex-M4; en la PC, en nanosegundos del reloj monotónico. Las estadísticas de cada región se guardan en una tabla
+ ** estática la primera vez que termina y se consultan con ProfileGetStats(). Si PROFILE_ENABLED no está definida en
+ ** uno, las macros no generan código.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef PROFILE_ENABLED
+#define PROFILE_ENABLED 0 //!< Uno para medir las regiones marcadas, cero para quitar las mediciones del firmware
+#endif
+
+#ifndef PROFILE_REGIONS_MAX
+#define PROFILE_REGIONS_MAX 8 //!< Cantidad máxima de regiones medidas, reservadas en memoria estática
+#endif
+
+#define PROFILE_BUCKETS 16 //!< Cantidad de intervalos del histograma, cada uno el doble de ancho que el anterior
+
+#define PROFILE_BUCKET_SHIFT 4 //!< El primer intervalo del histograma cuenta las duraciones menores a 2^4
+
+#if PROFILE_ENABLED
+/** Habilita el contador de ciclos, se llama una vez al arrancar */
+#define PROFILE_INIT() ProfileInit()
+
+/** Marca el comienzo de una región, declara la variable que guarda el instante inicial */
+#define PROFILE_BEGIN(name) uint32_t profile_##name##_started = ProfileNow()
+
+/** Marca el final de una región y suma la duración a sus estadísticas */
+#define PROFILE_END(name)                                                                                              \
+    do {                                                                                                               \
+        static profile_region_t profile_##name##_region;                                                               \
+        ProfileRecord(&profile_##name##_region, #name, ProfileNow() - profile_##name##_started);                       \
+    } while (0)
+#else
+#define PROFILE_INIT()      ((void)0)
+#define PROFILE_BEGIN(name) ((void)0)
+#define PROFILE_END(name)   ((void)0)
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Referencia a la entrada de una región en la tabla de estadísticas
+typedef struct profile_region_s * profile_region_t;
+
+//! Estadísticas de una región, en ciclos del núcleo o en nanosegundos en la PC
+typedef struct profile_stats_s {
+    const char * name;                    //!< Nombre de la región
+    uint32_t count;                       //!< Cantidad de ejecuciones medidas
+    uint32_t min;                         //!< Duración mínima
+    uint32_t max;                         //!< Duración máxima
+    uint32_t mean;                        //!< Duración promedio
+    uint32_t histogram[PROFILE_BUCKETS];  //!< Ejecuciones con duración menor a 2^(i + PROFILE_BUCKET_SHIFT)
+} profile_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Habilita el contador de ciclos del núcleo
+ */
+void ProfileInit(void);
+
+/**
+ * @brief Devuelve el instante actual del contador usado para medir
+ *
+ * @return uint32_t Ciclos del núcleo, o nanosegundos en la PC, desde un origen arbitrario
+ */
+uint32_t ProfileNow(void);
+
+/**
+ * @brief Suma una duración a las estadísticas de una región
+ *
+ * @param region Entrada de la región, NULL la primera vez para reservarla en la tabla
+ * @param name Nombre de la región
+ * @param duration Duración medida
+ */
+void ProfileRecord(profile_region_t * region, const char * name, uint32_t duration);
+
+/**
+ * @brief Consulta las estadísticas de una región
+ *
+ * @param index Posición de la región en la tabla, en el orden en que se midieron por primera vez
+ * @param stats Estadísticas de la región
+ * @return true si la región existe
+ */
+bool ProfileGetStats(uint8_t index, profile_stats_t * stats);
+
+/**
+ * @brief Borra las estadísticas de todas las regiones, que conservan su lugar en la tabla
+ */
+void ProfileReset(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILE_H_ */
@@ -0,0 +1,143 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+/** @file scheduler.h
+ ** @brief Planificador cooperativo de tareas que se ejecutan hasta terminar
+ **
+ ** Las tareas se describen en una tabla estática del programa: la función, su prioridad, el período en ticks o cero
+ ** si solo se activa con SchedulerSignal(), y el plazo para terminar. SchedulerTick() se llama desde el temporizador
+ ** de tiempo y activa las tareas periódicas; SchedulerSignal() activa una tarea desde una interrupción o desde otra
+ ** tarea. El programa principal llama a SchedulerDispatch() en su lazo, que ejecuta la tarea activa de mayor prioridad
+ ** o duerme con la función indicada si no hay ninguna.
+ **
+ ** Ninguna tarea interrumpe a otra, así que una tarea larga demora a las demás. Por eso cada tarea cuenta las
+ ** ejecuciones, la mayor demora entre la activación y el inicio y los plazos perdidos: las que terminaron tarde y las
+ ** activaciones periódicas que llegaron antes de atender la anterior.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Función de una tarea, se ejecuta hasta terminar
+typedef void (*scheduler_function_t)(void * context);
+
+/**
+ * @brief Función que duerme al núcleo hasta la próxima interrupción
+ *
+ * SchedulerDispatch() la llama con las interrupciones bloqueadas. Debe volver con el mismo bloqueo con que fue
+ * llamada: si lo levanta para atender la interrupción que la despertó, lo restituye antes de volver.
+ */
+typedef void (*scheduler_sleep_t)(void);
+
+//! Estadísticas de una tarea, en ticks de SchedulerTick()
+typedef struct scheduler_stats_s {
+    uint32_t runs;        //!< Ejecuciones completas
+    uint32_t misses;      //!< Plazos perdidos: terminó tarde o se volvió a activar sin haber ejecutado
+    uint16_t max_latency; //!< Mayor demora entre la activación y el inicio de una ejecución
+} scheduler_stats_t;
+
+//! Descriptor de una tarea, la configuración se completa en la tabla y el resto lo inicia SchedulerCreate()
+typedef struct scheduler_task_s {
+    scheduler_function_t function; //!< Función de la tarea
+    void * context;                //!< Contexto que recibe la función
+    uint8_t priority;              //!< Prioridad, cero es la más alta; las iguales se ordenan por la tabla
+    uint16_t period;               //!< Ticks entre activaciones, cero si solo se activa con SchedulerSignal()
+    uint16_t deadline;             //!< Ticks desde la activación para terminar, cero para usar el período
+    volatile bool ready;           //!< La tarea está activa y espera ejecutarse
+    uint16_t countdown;            //!< Ticks que faltan para la próxima activación periódica
+    uint32_t released;             //!< Tick de la última activación
+    scheduler_stats_t stats;       //!< Estadísticas de la tarea
+} scheduler_task_t;
+
+//! Referencia a un planificador
+typedef struct scheduler_s * scheduler_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un planificador sobre una tabla de tareas, sin ninguna activa
+ *
+ * @param tasks Tabla de tareas, debe existir mientras se use el planificador
+ * @param count Cantidad de tareas de la tabla
+ * @param sleep Función para dormir cuando no hay tareas activas, o NULL para volver enseguida
+ * @return scheduler_t Planificador creado, o NULL si ya se usaron los SCHEDULER_MAX_INSTANCES disponibles
+ */
+scheduler_t SchedulerCreate(scheduler_task_t * tasks, uint8_t count, scheduler_sleep_t sleep);
+
+/**
+ * @brief Avanza un tick y activa las tareas periódicas que cumplen su período, se llama desde el temporizador
+ *
+ * @param self Planificador
+ */
+void SchedulerTick(scheduler_t self);
+
+/**
+ * @brief Activa una tarea, se puede llamar desde una interrupción o desde otra tarea
+ *
+ * @param self Planificador
+ * @param task Posición de la tarea en la tabla
+ */
+void SchedulerSignal(scheduler_t self, uint8_t task);
+
+/**
+ * @brief Ejecuta la tarea activa de mayor prioridad o duerme si no hay ninguna, es el cuerpo del lazo principal
+ *
+ * La consulta de las tareas activas y la llamada a la función para dormir se hacen con las interrupciones bloqueadas,
+ * así una activación que llega justo antes de dormir despierta al núcleo en lugar de esperar a la siguiente. Al volver
+ * se restituye el bloqueo que había al llamarla.
+ *
+ * @param self Planificador
+ * @return true Si ejecutó una tarea
+ * @return false Si no había tareas activas
+ */
+bool SchedulerDispatch(scheduler_t self);
+
+/**
+ * @brief Consulta las estadísticas de una tarea
+ *
+ * @param self Planificador
+ * @param task Posición de la tarea en la tabla
+ * @param stats Estadísticas de la tarea
+ */
+void SchedulerGetStats(scheduler_t self, uint8_t task, scheduler_stats_t * stats);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDULER_H_ */
@@ -28,6 +28,7 @@ SPDX-License-Identifier: MIT
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "screen_config.h"
 
 /* === Header for C++ compatibility ================================================================================ */
 
@@ -37,15 +38,21 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
-#define SEGMENT_A (1 << 0)
-#define SEGMENT_B (1 << 1)
-#define SEGMENT_C (1 << 2)
-#define SEGMENT_D (1 << 3)
-#define SEGMENT_E (1 << 4)
-#define SEGMENT_F (1 << 5)
-#define SEGMENT_G (1 << 6)
-#define SEGMENT_P (1 << 7)
+/* Segmentos en la palabra que recibe SegmentsUpdate, en la posición que declara screen_config.h para la placa */
+#define SEGMENT_A (1 << SCREEN_SEGMENT_A_BIT)
+#define SEGMENT_B (1 << SCREEN_SEGMENT_B_BIT)
+#define SEGMENT_C (1 << SCREEN_SEGMENT_C_BIT)
+#define SEGMENT_D (1 << SCREEN_SEGMENT_D_BIT)
+#define SEGMENT_E (1 << SCREEN_SEGMENT_E_BIT)
+#define SEGMENT_F (1 << SCREEN_SEGMENT_F_BIT)
+#define SEGMENT_G (1 << SCREEN_SEGMENT_G_BIT)
+#define SEGMENT_P (1 << SCREEN_SEGMENT_P_BIT)
 
+#define SCREEN_BRIGHTNESS_MAX 4 //!< Nivel de brillo máximo de la pantalla
+
+/* Códigos especiales aceptados por ScreenWriteBCD además de los valores hexadecimales 0x0 a 0xF */
+#define SCREEN_GLYPH_BLANK 0x10 //!< Dígito apagado
+#define SCREEN_GLYPH_MINUS 0x11 //!< Signo menos
 
 /* === Public data type declarations =============================================================================== */
 
@@ -54,13 +61,14 @@ typedef struct screen_s * screen_t;
 typedef void (*digits_turn_off_t)(void);
 typedef void (*segments_update_t)(uint8_t);
 typedef void (*digits_turn_on_t)(uint8_t);
-
-
+typedef void (*scan_rate_set_t)(uint16_t);
 
 typedef struct screen_driver_s {
     digits_turn_off_t DigitsTurnOff;
     segments_update_t SegmentsUpdate;
     digits_turn_on_t DigitTurnOn;
+    scan_rate_set_t ScanRateSet; //!< Reprograma las llamadas por segundo a ScreenRefresh, cero para detenerlas. Es
+                                 //!< opcional: sin esta función se llama siempre a la frecuencia de ScreenSetTickRate()
 } const * screen_driver_t;
 
 /* === Public variable declarations ================================================================================ */
@@ -79,35 +87,143 @@ screen_t ScreenCreate(uint8_t digits, screen_driver_t driver);
 /**
  * @brief Función para escribir un valor en formato BCD en la pantalla.
  * 
+ * Acepta valores hexadecimales (0x0 a 0xF) y los códigos SCREEN_GLYPH_*. Cualquier otro valor se muestra apagado.
+ * 
  * @param screen Puntero a la instancia de la pantalla.
  * @param value Puntero al arreglo que contiene los valores BCD a escribir.
  * @param size Tamaño del arreglo de valores BCD.
  */
 void ScreenWriteBCD(screen_t screen, uint8_t * value, uint8_t size);
 
+/**
+ * @brief Publica un cuadro terminado: valores BCD y puntos decimales en una sola escritura por dígito.
+ *
+ * A diferencia de ScreenWriteBCD() seguida de ScreenSetDot(), el barrido nunca ve el dígito borrado ni sin sus
+ * puntos, por lo que se puede llamar desde el programa principal mientras el barrido corre en una interrupción.
+ *
+ * @param screen Puntero a la instancia de la pantalla.
+ * @param value Puntero al arreglo que contiene los valores BCD a escribir.
+ * @param size Tamaño del arreglo de valores BCD.
+ * @param dots Puntos encendidos, el bit n corresponde al dígito n.
+ */
+void ScreenPublishBCD(screen_t screen, const uint8_t * value, uint8_t size, uint8_t dots);
+
+/**
+ * @brief Función para escribir patrones de segmentos crudos en la pantalla.
+ * 
+ * @param screen Puntero a la instancia de la pantalla.
+ * @param segments Arreglo con los segmentos a encender en cada dígito, combinando las constantes SEGMENT_*. Si la
+ * pantalla o el arreglo son nulos no se escribe nada.
+ * @param size Tamaño del arreglo de segmentos.
+ */
+void ScreenWriteSegments(screen_t screen, const uint8_t * segments, uint8_t size);
+
+/**
+ * @brief Función para escribir un texto ASCII en la pantalla.
+ * 
+ * Se muestran los primeros caracteres del texto hasta completar los dígitos de la pantalla. Los caracteres sin
+ * representación en 7 segmentos se muestran apagados.
+ * 
+ * @param screen Puntero a la instancia de la pantalla.
+ * @param text Cadena terminada en nulo con el texto a mostrar. Si la pantalla o el texto son nulos no se escribe nada.
+ */
+void ScreenWriteText(screen_t screen, const char * text);
+
 /**
  * @brief  Función para refrescar la pantalla, actualizando el dígito actual.
  *
+ * La pantalla elige la menor frecuencia de barrido sin parpadeo para lo que muestra: la sube mientras hay dígitos
+ * parpadeando y, con el brillo reducido, divide el tiempo de cada dígito en SCREEN_BRIGHTNESS_MAX pasos. Si el driver
+ * tiene ScanRateSet, reprograma con esa función el temporizador que llama a ScreenRefresh, que barre un dígito o un
+ * paso en cada llamada, y lo detiene mientras no hay nada encendido. Sin ella se llama siempre a la frecuencia de
+ * ScreenSetTickRate() y la pantalla deja pasar las llamadas que no necesita.
  * 
  * @param screen  Puntero a la instancia de la pantalla.
  */
 void ScreenRefresh(screen_t screen);
 
+/**
+ * @brief Indica la mayor frecuencia con la que se puede llamar a ScreenRefresh()
+ * 
+ * Es la frecuencia de las llamadas si el driver no tiene ScanRateSet, y el límite de lo que se le pide si la tiene.
+ *
+ * @param screen Puntero a la instancia de la pantalla.
+ * @param ticks_per_second Cantidad de llamadas a ScreenRefresh por segundo, un valor nulo se ignora
+ */
+void ScreenSetTickRate(screen_t screen, uint16_t ticks_per_second);
+
+/**
+ * @brief Fija el brillo de la pantalla modulando el tiempo que permanece encendido cada dígito
+ * 
+ * @param screen Puntero a la instancia de la pantalla.
+ * @param brightness Nivel de brillo, de 1 a SCREEN_BRIGHTNESS_MAX
+ */
+void ScreenSetBrightness(screen_t screen, uint8_t brightness);
+
+/**
+ * @brief Obtiene la frecuencia real de barrido elegida por la pantalla
+ * 
+ * @param screen Puntero a la instancia de la pantalla.
+ * @return uint16_t Cantidad de dígitos barridos por segundo, cero si la pantalla es nula o el barrido está detenido
+ */
+uint16_t ScreenGetScanRate(screen_t screen);
+
+/**
+ * @brief Obtiene la cantidad de llamadas por segundo a ScreenRefresh() que necesita la pantalla
+ * 
+ * Es la última frecuencia pedida con ScanRateSet o, si el driver no la tiene, la de ScreenSetTickRate().
+ *
+ * @param screen Puntero a la instancia de la pantalla.
+ * @return uint16_t Llamadas por segundo, cero si la pantalla es nula o el barrido está detenido
+ */
+uint16_t ScreenGetRefreshRate(screen_t screen);
+
 /**
  * @brief Función para hacer parpadear los digitos del display
  * 
  * @param display Puntero al descriptor de la pantalla con la que se quiere operar
  * @param from Posición del primer digito que se quiere hacer parpadear
  * @param to Posición del ultimo digito que se quiere hacer parpadear
- * @param frecuency Factor de división de la frecuencia de refresco para el parpadeo
+ * @param frecuency Factor de división de la frecuencia de refresco para el parpadeo, medido en cuadros completos a la
+ * frecuencia de ScreenSetTickRate()
  */
 int DisplayFlashDigits(screen_t screen, uint8_t from, uint8_t to, uint16_t divisor);
 
+/**
+ * @brief Inicia el desplazamiento de un texto más largo que la pantalla
+ * 
+ * El texto se codifica una sola vez y luego la ventana visible avanza una posición cada cierta cantidad de cuadros
+ * desde ScreenRefresh, sin intervención del programa principal. Mientras el desplazamiento está activo se ignora el
+ * contenido escrito con las funciones ScreenWrite*.
+ * 
+ * @param screen Puntero al descriptor de la pantalla con la que se quiere operar
+ * @param text Cadena terminada en nulo con el texto a desplazar
+ * @param divisor Cantidad de cuadros completos entre cada desplazamiento, medidos a la frecuencia de
+ * ScreenSetTickRate()
+ * @return int 0 si se inició el desplazamiento, -1 si los parámetros son inválidos o el texto es demasiado largo
+ */
+int ScreenStartScroll(screen_t screen, const char * text, uint16_t divisor);
+
+/**
+ * @brief Detiene el desplazamiento y vuelve a mostrar el contenido escrito en la pantalla
+ * 
+ * @param screen Puntero al descriptor de la pantalla con la que se quiere operar
+ */
+void ScreenStopScroll(screen_t screen);
+
+/**
+ * @brief Indica si hay un desplazamiento de texto en curso
+ * 
+ * @param screen Puntero al descriptor de la pantalla con la que se quiere operar
+ * @return true si el texto se está desplazando, false en caso contrario
+ */
+bool ScreenIsScrolling(screen_t screen);
+
 /**
  * @brief  Cambia el estado de un punto decimal en la pantalla
  * 
  * @param screen Puntero a la estructura de control de la pantalla
- * @param position Posición del punto decimal a cambiar
+ * @param position Posición del punto decimal a cambiar, se ignora si la pantalla no tiene ese dígito
  */
 void ScreenToggleDot(screen_t screen, uint8_t position);
 
@@ -115,7 +231,7 @@ void ScreenToggleDot(screen_t screen, uint8_t position);
  * @brief Establece el estado de un punto decimal en la pantalla
  * 
  * @param screen Puntero a la estructura de control de la pantalla
- * @param position Posición del punto decimal a cambiar
+ * @param position Posición del punto decimal a cambiar, se ignora si la pantalla no tiene ese dígito
  * @param on Estado deseado del punto
  */
 void ScreenSetDot(screen_t screen, uint8_t position, bool on);
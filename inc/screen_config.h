@@ -0,0 +1,88 @@
+/*********************************************************************************************************************
+Copyright (c) Año, Nombre y Apellido del autor <correo@ejemplo.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef SCREEN_CONFIG_H_
+#define SCREEN_CONFIG_H_
+
+/** @file screen_config.h
+ ** @brief Posición de los segmentos en la palabra de la pantalla para la placa del reloj
+ **
+ ** Las posiciones salen de los pines declarados en poncho.h, así una placa con otro conexionado solo cambia poncho.h
+ ** y las tablas de imágenes se arman con su orden. screen.h lo incluye siempre, por lo que todos los módulos generan y
+ ** leen las imágenes con los mismos bits sin depender del orden de inclusión.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "poncho.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* Los segmentos A a G usan sus bits en SEGMENTS_GPIO para que la palabra se escriba directamente en el puerto */
+#define SCREEN_SEGMENT_A_BIT SEGMENT_A_BIT //!< Bit del segmento A
+#define SCREEN_SEGMENT_B_BIT SEGMENT_B_BIT //!< Bit del segmento B
+#define SCREEN_SEGMENT_C_BIT SEGMENT_C_BIT //!< Bit del segmento C
+#define SCREEN_SEGMENT_D_BIT SEGMENT_D_BIT //!< Bit del segmento D
+#define SCREEN_SEGMENT_E_BIT SEGMENT_E_BIT //!< Bit del segmento E
+#define SCREEN_SEGMENT_F_BIT SEGMENT_F_BIT //!< Bit del segmento F
+#define SCREEN_SEGMENT_G_BIT SEGMENT_G_BIT //!< Bit del segmento G
+
+/* El punto decimal solo entra en la misma palabra si está en el mismo puerto y dentro del primer byte. En el poncho
+ * está en GPIO5 bit 16, lejos de los segmentos en GPIO2, así que ocupa el bit libre de la palabra y el driver de la
+ * placa lo escribe aparte con una segunda escritura en cada barrido. */
+#if (SEGMENT_P_GPIO == SEGMENTS_GPIO) && (SEGMENT_P_BIT < 8)
+#define SCREEN_SEGMENT_P_BIT SEGMENT_P_BIT //!< Bit del punto decimal, el mismo del puerto
+#elif !(SEGMENTS_MASK & (1 << 7))
+#define SCREEN_SEGMENT_P_BIT 7 //!< Bit del punto decimal, el que dejan libre los segmentos
+#elif !(SEGMENTS_MASK & (1 << 6))
+#define SCREEN_SEGMENT_P_BIT 6
+#elif !(SEGMENTS_MASK & (1 << 5))
+#define SCREEN_SEGMENT_P_BIT 5
+#elif !(SEGMENTS_MASK & (1 << 4))
+#define SCREEN_SEGMENT_P_BIT 4
+#elif !(SEGMENTS_MASK & (1 << 3))
+#define SCREEN_SEGMENT_P_BIT 3
+#elif !(SEGMENTS_MASK & (1 << 2))
+#define SCREEN_SEGMENT_P_BIT 2
+#elif !(SEGMENTS_MASK & (1 << 1))
+#define SCREEN_SEGMENT_P_BIT 1
+#else
+#define SCREEN_SEGMENT_P_BIT 0
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCREEN_CONFIG_H_ */
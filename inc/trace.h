@@ -0,0 +1,157 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+/** @file trace.h
+ ** @brief Registro binario de eventos en un anillo de memoria, para reconstruir qué pasó en un equipo en el campo
+ **
+ ** Cada evento se marca con TRACE() y se guarda en un registro de cuatro bytes: el tiempo desde el registro anterior,
+ ** el evento y un dato de un byte. Los registros llenan un anillo estático que conserva los últimos TRACE_RECORDS; el
+ ** anillo empieza con una cabecera que describe el formato, así que una copia de la memoria tomada con el depurador o
+ ** con TraceGetBuffer() se puede decodificar en la PC con build/host/tracedecode.
+ **
+ ** El tiempo se cuenta en ciclos del núcleo divididos por 2^TRACE_TIME_SHIFT, con el CYCCNT de la unidad DWT en el
+ ** microcontrolador y con el modelo del núcleo de HostCoreCycles() en la PC. Cuando pasa más tiempo del que entra en
+ ** un registro se agrega antes uno de TRACE_GAP con la parte alta. Si TRACE_ENABLED no está definida en uno, las macros
+ ** no generan código.
+ **
+ ** Las entradas y salidas de las interrupciones llenan el anillo en pocos milisegundos, por eso TRACE_MASK las deja
+ ** afuera al iniciar. Se agregan con TraceSetMask(), por ejemplo para estudiar la demora de una interrupción.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 0 //!< Uno para registrar los eventos marcados, cero para quitar el registro del firmware
+#endif
+
+#ifndef TRACE_RECORDS
+#define TRACE_RECORDS 512 //!< Cantidad de registros del anillo, una potencia de dos
+#endif
+
+#define TRACE_TIME_SHIFT 6 //!< El tiempo se registra en unidades de 2^6 ciclos, 0,31 us a 204 MHz
+
+#define TRACE_MAGIC 0x31435254 //!< Identifica la cabecera del anillo, "TRC1" en memoria
+
+#ifndef TRACE_MASK
+//! Eventos registrados al iniciar, el bit n corresponde al evento n
+#define TRACE_MASK (UINT32_MAX & ~((1UL << TRACE_ISR_ENTER) | (1UL << TRACE_ISR_EXIT)))
+#endif
+
+#if TRACE_ENABLED
+/** Inicia el anillo vacío, se llama una vez al arrancar */
+#define TRACE_INIT() TraceInit()
+
+/** Registra un evento con un dato de un byte */
+#define TRACE(event, payload) TraceRecord((event), (payload))
+#else
+#define TRACE_INIT()          ((void)0)
+#define TRACE(event, payload) ((void)0)
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Eventos registrados
+typedef enum {
+    TRACE_GAP,               //!< Parte alta del tiempo del registro siguiente, en el campo del tiempo
+    TRACE_ISR_ENTER,         //!< Entrada a una interrupción, el dato es un trace_isr_t
+    TRACE_ISR_EXIT,          //!< Salida de una interrupción, el dato es un trace_isr_t
+    TRACE_CLOCK_SECOND,      //!< El reloj avanzó un segundo, el dato son los segundos en BCD
+    TRACE_ALARM_FIRE,        //!< Empezó a sonar la alarma
+    TRACE_ALARM_SNOOZE,      //!< Se pospuso la alarma unos minutos
+    TRACE_ALARM_POSTPONE,    //!< Se pospuso la alarma hasta el otro día
+    TRACE_STATE,             //!< Cambio de estado de una máquina de estados, el dato es el estado nuevo
+    TRACE_INPUT_ACTIVATED,   //!< Flanco filtrado de activación de una entrada, el dato es el puerto * 32 + el bit
+    TRACE_INPUT_DEACTIVATED, //!< Flanco filtrado de desactivación de una entrada, el dato es el puerto * 32 + el bit
+    TRACE_EVENTS_COUNT,      //!< Cantidad de eventos
+} trace_event_t;
+
+//! Interrupciones registradas con TRACE_ISR_ENTER y TRACE_ISR_EXIT
+typedef enum {
+    TRACE_ISR_SCAN, //!< Temporizador de barrido
+    TRACE_ISR_TICK, //!< Temporizador de tiempo
+} trace_isr_t;
+
+//! Registro de un evento
+typedef struct trace_record_s {
+    uint16_t delta;  //!< Tiempo desde el registro anterior, en unidades de 2^shift ciclos
+    uint8_t event;   //!< Evento, un trace_event_t
+    uint8_t payload; //!< Dato del evento
+} trace_record_t;
+
+//! Anillo de registros con la cabecera que describe el formato
+typedef struct trace_buffer_s {
+    uint32_t magic;                        //!< TRACE_MAGIC
+    uint32_t clock;                        //!< Frecuencia del núcleo en Hz
+    uint16_t shift;                        //!< Ciclos por unidad de tiempo, en potencia de dos
+    uint16_t capacity;                     //!< Cantidad de registros del anillo
+    uint32_t written;                      //!< Registros escritos desde el inicio, el próximo va en written % capacity
+    trace_record_t records[TRACE_RECORDS]; //!< Registros
+} trace_buffer_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Habilita el contador de ciclos e inicia el anillo vacío, registrando los eventos de TRACE_MASK
+ */
+void TraceInit(void);
+
+/**
+ * @brief Registra un evento, se puede llamar desde el programa principal y desde las interrupciones
+ *
+ * @param event Evento, un trace_event_t
+ * @param payload Dato del evento
+ */
+void TraceRecord(uint8_t event, uint8_t payload);
+
+/**
+ * @brief Elige los eventos que se registran
+ *
+ * @param mask Eventos registrados, el bit n corresponde al evento n
+ */
+void TraceSetMask(uint32_t mask);
+
+/**
+ * @brief Devuelve el anillo para copiarlo, por ejemplo a un archivo en la PC
+ *
+ * @return const trace_buffer_t* Anillo con la cabecera
+ */
+const trace_buffer_t * TraceGetBuffer(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_H_ */
@@ -0,0 +1,865 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file app.c
+ ** @brief Implementación de la aplicación del reloj despertador
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "app.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "clock.h"
+#include "fsm.h"
+#include "gesture.h"
+#include "latency.h"
+#include "pattern.h"
+#include "profile.h"
+
+/* === Macros definitions ========================================================================================== */
+
+#define CLOCK_TICKS_PER_SECOND APP_TICKS_PER_SECOND  ///< Cantidad de ticks por segundo
+#define TICK_MS (1000 / APP_TICKS_PER_SECOND)        ///< Milisegundos entre llamadas a AppTick()
+#define BUTTON_SET_DELAY 3000        ///< Tiempo de presión para entrar en modo ajuste (ms)
+#define DISPLAY_FLASH_FREQUENCY 200  ///< Frecuencia de parpadeo de dígitos
+#define INACTIVITY_TIMEOUT_MS 30000  ///< Tiempo máximo de inactividad (ms)
+#define KEYS_SCAN_PERIOD_MS 5        ///< Intervalo entre lecturas de las teclas, filtra rebotes de hasta 20 ms (ms)
+#define ADJUST_REPEAT_DELAY 500      ///< Tiempo de presión hasta que el ajuste empieza a repetirse (ms)
+
+#ifndef APP_MAX_INSTANCES
+#define APP_MAX_INSTANCES 1 //!< Cantidad máxima de instancias, más de una solo tiene sentido en los simuladores de la PC
+#endif
+
+#if PATTERN_TICKS_PER_SECOND != APP_TICKS_PER_SECOND
+#error "Las secuencias avanzan en AppTick(), PATTERN_TICKS_PER_SECOND debe ser APP_TICKS_PER_SECOND"
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Estados de funcionamiento del reloj
+ *
+ */
+typedef enum {
+    UNCONFIGURED = 1, //!< Hora no configurada, el cero está reservado para FSM_STAY
+    SHOW_TIME,        //!< Visualización de hora actual
+    SET_TIME_MINUTE,  //!< Configuración de los minutos 
+    SET_TIME_HOUR,    //!< Configuración de las horas
+    SET_ALARM_MINUTE, //!< Configuración de los minutos de la alarma
+    SET_ALARM_HOUR,   //!< Configuración de las horas de la alarma
+    MODES_COUNT,      //!< Cantidad de modos, incluido FSM_STAY
+} states_clock;
+
+/**
+ * @brief Teclas cuyos gestos se reconocen
+ *
+ */
+typedef enum {
+    GESTURE_KEY_SET_TIME,  //!< Tecla para ajustar la hora
+    GESTURE_KEY_SET_ALARM, //!< Tecla para ajustar la alarma
+    GESTURE_KEY_DECREMENT, //!< Tecla para decrementar el valor en ajuste
+    GESTURE_KEY_INCREMENT, //!< Tecla para incrementar el valor en ajuste
+    GESTURE_KEYS_COUNT,    //!< Cantidad de teclas con gestos
+} gesture_keys_t;
+
+/**
+ * @brief Eventos que atiende la máquina de estados de los modos
+ *
+ */
+typedef enum {
+    EVENT_SET_TIME,  //!< Presión larga de la tecla para ajustar la hora
+    EVENT_SET_ALARM, //!< Presión larga de la tecla para ajustar la alarma
+    EVENT_ACCEPT,    //!< Tecla aceptar
+    EVENT_CANCEL,    //!< Tecla cancelar
+    EVENT_DECREMENT, //!< Clic o repetición de la tecla para decrementar
+    EVENT_INCREMENT, //!< Clic o repetición de la tecla para incrementar
+    EVENT_TIMEOUT,   //!< Pasó el tiempo máximo de inactividad
+    EVENTS_COUNT,    //!< Cantidad de eventos
+} app_event_t;
+
+/*! Estado de una instancia de la aplicación */
+struct app_s {
+    board_t board;                          //!< Placa sobre la que funciona
+    clock_t clock;                          //!< Reloj con la hora y la alarma
+    fsm_t modes;                            //!< Máquina de estados de los modos de funcionamiento
+    uint8_t digits[4];                      //!< Valor mostrado o en ajuste, en BCD
+    uint32_t inactivity_timer;              //!< Milisegundos desde la última acción del usuario
+    uint16_t flash_counter;                 //!< Milisegundos del segundo en curso del reloj, para el parpadeo del punto
+    volatile bool render_pending;           //!< Cambió algo de lo que se muestra y hay que publicar un cuadro nuevo
+    uint8_t keys_counter;                   //!< Milisegundos desde la última lectura de las teclas
+    clock_time_t current_time_data;         //!< Hora leída o en ajuste
+    clock_time_t alarm_time_data;           //!< Alarma leída o en ajuste
+    gesture_t gestures[GESTURE_KEYS_COUNT]; //!< Reconocedores de gestos de las teclas
+    pattern_player_t alarm_sound;           //!< Secuencia del zumbador mientras suena la alarma
+    pattern_player_t alarm_light;           //!< Secuencia del LED rojo mientras suena la alarma
+    app_notify_t notify;                    //!< Función que avisa al programa principal, o NULL
+    void * notify_context;                  //!< Puntero que se le pasa a la función de aviso
+};
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Alarma sonando
+ * 
+ * @param clock invocacion al reloj
+ */
+static void AlarmaRinging(clock_t clock);
+
+/**
+ * @brief Reinicia el tiempo de inactividad y elige los dígitos que parpadean en el modo que empieza
+ *
+ * @param self Instancia de la aplicación
+ * @param from Primer dígito que parpadea
+ * @param to Último dígito que parpadea
+ * @param divisor Divisor del parpadeo, cero para no parpadear
+ */
+static void enter_mode(app_t self, uint8_t from, uint8_t to, uint16_t divisor);
+
+/**
+ * @brief Entrada al modo sin hora configurada, parpadean todos los dígitos
+ *
+ * @param context Instancia de la aplicación
+ */
+static void enter_unconfigured(void * context);
+
+/**
+ * @brief Entrada al modo que muestra la hora
+ *
+ * @param context Instancia de la aplicación
+ */
+static void enter_show_time(void * context);
+
+/**
+ * @brief Entrada a los modos de ajuste de los minutos de la hora o de la alarma, parpadean los minutos
+ *
+ * @param context Instancia de la aplicación
+ */
+static void enter_set_minutes(void * context);
+
+/**
+ * @brief Entrada a los modos de ajuste de las horas de la hora o de la alarma, parpadean las horas
+ *
+ * @param context Instancia de la aplicación
+ */
+static void enter_set_hours(void * context);
+
+/**
+ * @brief Entrada al ajuste de los minutos de la alarma, que además cambia los puntos
+ *
+ * @param context Instancia de la aplicación
+ */
+static void enter_set_alarm_minutes(void * context);
+
+/**
+ * @brief Entrada al ajuste de las horas de la alarma, que además cambia los puntos
+ *
+ * @param context Instancia de la aplicación
+ */
+static void enter_set_alarm_hours(void * context);
+
+/**
+ * @brief Carga la hora actual en los dígitos para empezar a ajustarla, 00:00 si no está configurada
+ *
+ * @param context Instancia de la aplicación
+ * @param next Modo siguiente según la tabla
+ * @return uint8_t Modo siguiente
+ */
+static uint8_t edit_time(void * context, uint8_t next);
+
+/**
+ * @brief Carga la alarma en los dígitos para empezar a ajustarla, 00:00 si no está configurada
+ *
+ * @param context Instancia de la aplicación
+ * @param next Modo siguiente según la tabla
+ * @return uint8_t Modo siguiente
+ */
+static uint8_t edit_alarm(void * context, uint8_t next);
+
+/**
+ * @brief Guarda en el reloj la hora ajustada
+ *
+ * @param context Instancia de la aplicación
+ * @param next Modo siguiente según la tabla
+ * @return uint8_t Modo siguiente
+ */
+static uint8_t store_time(void * context, uint8_t next);
+
+/**
+ * @brief Guarda en el reloj la alarma ajustada
+ *
+ * @param context Instancia de la aplicación
+ * @param next Modo siguiente según la tabla
+ * @return uint8_t Modo siguiente
+ */
+static uint8_t store_alarm(void * context, uint8_t next);
+
+/**
+ * @brief Sale del ajuste de la hora sin guardarla, a mostrar la hora si ya estaba configurada
+ *
+ * @param context Instancia de la aplicación
+ * @param next Modo siguiente según la tabla, no se usa
+ * @return uint8_t Modo siguiente, mostrar la hora o sin configurar
+ */
+static uint8_t leave_time_edit(void * context, uint8_t next);
+
+/**
+ * @brief Aceptar mientras se muestra la hora: vuelve a activar la alarma y pospone la que está sonando
+ *
+ * @param context Instancia de la aplicación
+ * @param next Modo siguiente según la tabla
+ * @return uint8_t Modo siguiente
+ */
+static uint8_t snooze_alarm(void * context, uint8_t next);
+
+/**
+ * @brief Cancelar mientras se muestra la hora: apaga la alarma que suena hasta mañana o desactiva la alarma
+ *
+ * @param context Instancia de la aplicación
+ * @param next Modo siguiente según la tabla
+ * @return uint8_t Modo siguiente
+ */
+static uint8_t cancel_alarm(void * context, uint8_t next);
+
+/**
+ * @brief Decrementa los minutos en ajuste
+ *
+ * @param context Instancia de la aplicación
+ * @param next Modo siguiente según la tabla
+ * @return uint8_t Modo siguiente
+ */
+static uint8_t decrement_minutes(void * context, uint8_t next);
+
+/**
+ * @brief Incrementa los minutos en ajuste
+ *
+ * @param context Instancia de la aplicación
+ * @param next Modo siguiente según la tabla
+ * @return uint8_t Modo siguiente
+ */
+static uint8_t increment_minutes(void * context, uint8_t next);
+
+/**
+ * @brief Decrementa las horas en ajuste
+ *
+ * @param context Instancia de la aplicación
+ * @param next Modo siguiente según la tabla
+ * @return uint8_t Modo siguiente
+ */
+static uint8_t decrement_hours(void * context, uint8_t next);
+
+/**
+ * @brief Incrementa las horas en ajuste
+ *
+ * @param context Instancia de la aplicación
+ * @param next Modo siguiente según la tabla
+ * @return uint8_t Modo siguiente
+ */
+static uint8_t increment_hours(void * context, uint8_t next);
+
+/**
+ * @brief Muestra el valor después de un paso de ajuste y reinicia el tiempo de inactividad
+ *
+ * @param self Instancia de la aplicación
+ */
+static void show_adjusted(app_t self);
+
+/**
+ * @brief Arma y publica el cuadro de los modos que muestran la hora, con los puntos de la alarma y del segundo
+ *
+ * @param self Instancia de la aplicación
+ */
+static void render_frame(app_t self);
+
+/**
+ * @brief Incrementa el valor de un numero en BCD respetando un limite maximo
+ * 
+ * @param units Unidades
+ * @param tens Decenas
+ * @param max_units Máximo de unidades
+ * @param max_tens Máximo de decenas
+ */
+static void clock_increment_bcd(uint8_t *units, uint8_t *tens, uint8_t max_units, uint8_t max_tens);
+
+/**
+ * @brief Decrementa el valor de un numero en BCD respetando un limite maximo
+ * 
+ * @param units Unidades
+ * @param tens Decenas
+ * @param max_units Máximo de unidades
+ * @param max_tens Máximo de decenas
+ */
+static void clock_decrement_bcd(uint8_t *units, uint8_t *tens, uint8_t max_units, uint8_t max_tens);
+
+/**
+ * @brief Convierte un tiempo de un arreglo BCD de 4 dígitos a clock_time_t
+ * 
+ * @param time Puntero a la estructura de tiempo  clock_time_t
+ * @param bcd Puntero a un arreglo de 4 elementos donde se almacena el tiempo en formato [decena_hora, unidad_hora,
+ * decena_minuto, unidad_minuto]
+ */
+static void clock_convert_time_to_bcd(clock_time_t *time, uint8_t *bcd);
+
+/**
+ * @brief Convierte un tiempo en formato clock_time_t a un arreglo BCD de 4 dígitos.
+ * 
+ * @param time Puntero a la estructura de tiempo  clock_time_t
+ * @param bcd Puntero a un arreglo de 4 elementos donde se almacena el tiempo en formato [decena_hora, unidad_hora,
+ * decena_minuto, unidad_minuto]
+ */
+static void clock_convert_bcd_to_time(clock_time_t *time, uint8_t *bcd);
+
+/**
+ * @brief Indica si una tecla de ajuste pidió un paso, con un clic o una repetición
+ * 
+ * @param self Instancia de la aplicación
+ * @param key Tecla a consultar
+ * @return true si corresponde un paso de ajuste
+ * @return false si no hay pasos pendientes
+ */
+static bool adjust_step_requested(app_t self, gesture_keys_t key);
+
+/**
+ * @brief Atiende el evento de una tecla en el modo actual y marca el comienzo del manejador para medir la latencia
+ * 
+ * @param self Instancia de la aplicación
+ * @param event Evento generado por la tecla
+ */
+static void dispatch_key(app_t self, app_event_t event);
+
+/**
+ * @brief Muestra u oculta los cuatro puntos, que indican que se está ajustando la alarma
+ * 
+ * @param self Instancia de la aplicación
+ */
+static void toggle_alarm_dots(app_t self);
+
+/**
+ * @brief Pide un trabajo al programa principal, si registró una función de aviso
+ *
+ * @param self Instancia de la aplicación
+ * @param work Trabajo pedido
+ */
+static void request_work(app_t self, app_work_t work);
+
+/**
+ * @brief Marca que cambió algo de lo que se muestra y pide un cuadro nuevo al programa principal
+ *
+ * @param self Instancia de la aplicación
+ */
+static void request_render(app_t self);
+
+/* === Private variable definitions ============================================================ */
+
+/* Gestos de cada tecla: presión larga para entrar en ajuste, repetición acelerada para cambiar el valor */
+static const struct gesture_config_s GESTURE_CONFIG[GESTURE_KEYS_COUNT] = {
+    [GESTURE_KEY_SET_TIME] = {.long_press_ms = BUTTON_SET_DELAY},
+    [GESTURE_KEY_SET_ALARM] = {.long_press_ms = BUTTON_SET_DELAY},
+    [GESTURE_KEY_DECREMENT] = {.repeat_delay_ms = ADJUST_REPEAT_DELAY, .repeat_period_ms = 250, .repeat_min_ms = 50,
+                               .repeat_step_ms = 25},
+    [GESTURE_KEY_INCREMENT] = {.repeat_delay_ms = ADJUST_REPEAT_DELAY, .repeat_period_ms = 250, .repeat_min_ms = 50,
+                               .repeat_step_ms = 25},
+};
+
+//! Instancias disponibles y cantidad ya creadas
+static struct app_s instances[APP_MAX_INSTANCES];
+static uint16_t instances_used;
+
+//! Acciones de entrada a cada modo
+static const fsm_state_t MODES[MODES_COUNT] = {
+    [UNCONFIGURED] = {.entry = enter_unconfigured},
+    [SHOW_TIME] = {.entry = enter_show_time},
+    [SET_TIME_MINUTE] = {.entry = enter_set_minutes},
+    [SET_TIME_HOUR] = {.entry = enter_set_hours},
+    [SET_ALARM_MINUTE] = {.entry = enter_set_alarm_minutes},
+    [SET_ALARM_HOUR] = {.entry = enter_set_alarm_hours},
+};
+
+/* Qué hace cada evento en cada modo, las combinaciones que no figuran se ignoran. Las presiones largas de las teclas
+ * de ajuste empiezan a ajustar desde cualquier modo. */
+static const fsm_transition_t MODE_TRANSITIONS[MODES_COUNT][EVENTS_COUNT] = {
+    [UNCONFIGURED] = {
+        [EVENT_SET_TIME] = {edit_time, SET_TIME_MINUTE},
+        [EVENT_SET_ALARM] = {edit_alarm, SET_ALARM_MINUTE},
+    },
+    [SHOW_TIME] = {
+        [EVENT_SET_TIME] = {edit_time, SET_TIME_MINUTE},
+        [EVENT_SET_ALARM] = {edit_alarm, SET_ALARM_MINUTE},
+        [EVENT_ACCEPT] = {snooze_alarm, FSM_STAY},
+        [EVENT_CANCEL] = {cancel_alarm, FSM_STAY},
+    },
+    [SET_TIME_MINUTE] = {
+        [EVENT_SET_TIME] = {edit_time, SET_TIME_MINUTE},
+        [EVENT_SET_ALARM] = {edit_alarm, SET_ALARM_MINUTE},
+        [EVENT_ACCEPT] = {NULL, SET_TIME_HOUR},
+        [EVENT_CANCEL] = {leave_time_edit, SHOW_TIME},
+        [EVENT_DECREMENT] = {decrement_minutes, FSM_STAY},
+        [EVENT_INCREMENT] = {increment_minutes, FSM_STAY},
+        [EVENT_TIMEOUT] = {leave_time_edit, SHOW_TIME},
+    },
+    [SET_TIME_HOUR] = {
+        [EVENT_SET_TIME] = {edit_time, SET_TIME_MINUTE},
+        [EVENT_SET_ALARM] = {edit_alarm, SET_ALARM_MINUTE},
+        [EVENT_ACCEPT] = {store_time, SHOW_TIME},
+        [EVENT_CANCEL] = {leave_time_edit, SHOW_TIME},
+        [EVENT_DECREMENT] = {decrement_hours, FSM_STAY},
+        [EVENT_INCREMENT] = {increment_hours, FSM_STAY},
+        [EVENT_TIMEOUT] = {leave_time_edit, SHOW_TIME},
+    },
+    [SET_ALARM_MINUTE] = {
+        [EVENT_SET_TIME] = {edit_time, SET_TIME_MINUTE},
+        [EVENT_SET_ALARM] = {edit_alarm, SET_ALARM_MINUTE},
+        [EVENT_ACCEPT] = {NULL, SET_ALARM_HOUR},
+        [EVENT_CANCEL] = {NULL, SHOW_TIME},
+        [EVENT_DECREMENT] = {decrement_minutes, FSM_STAY},
+        [EVENT_INCREMENT] = {increment_minutes, FSM_STAY},
+        [EVENT_TIMEOUT] = {NULL, SHOW_TIME},
+    },
+    [SET_ALARM_HOUR] = {
+        [EVENT_SET_TIME] = {edit_time, SET_TIME_MINUTE},
+        [EVENT_SET_ALARM] = {edit_alarm, SET_ALARM_MINUTE},
+        [EVENT_ACCEPT] = {store_alarm, SHOW_TIME},
+        [EVENT_CANCEL] = {NULL, SHOW_TIME},
+        [EVENT_DECREMENT] = {decrement_hours, FSM_STAY},
+        [EVENT_INCREMENT] = {increment_hours, FSM_STAY},
+        [EVENT_TIMEOUT] = {NULL, SHOW_TIME},
+    },
+};
+
+//! Máquina de estados de los modos de funcionamiento
+static const struct fsm_table_s MODE_TABLE = {
+    .states = MODES,
+    .transitions = &MODE_TRANSITIONS[0][0],
+    .states_count = MODES_COUNT,
+    .events_count = EVENTS_COUNT,
+};
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private function implementation ========================================================= */
+
+static void AlarmaRinging(clock_t clock){
+    /* El reloj no conoce la aplicación que lo usa, se busca la instancia dueña */
+    for (uint16_t index = 0; index < instances_used; index++) {
+        if (instances[index].clock == clock) {
+            PatternPlay(instances[index].alarm_sound, &PATTERN_ESCALATING);
+            PatternPlay(instances[index].alarm_light, &PATTERN_BREATHE);
+        }
+    }
+}
+
+static bool adjust_step_requested(app_t self, gesture_keys_t key) {
+    gesture_event_t event = GestureGetEvent(self->gestures[key]);
+    return (event == GESTURE_CLICK) || (event == GESTURE_REPEAT);
+}
+
+static void dispatch_key(app_t self, app_event_t event) {
+    LATENCY_MARK(LATENCY_HANDLED);
+    FsmDispatch(self->modes, event);
+}
+
+static void toggle_alarm_dots(app_t self) {
+    ScreenToggleDot(self->board->screen, 0);
+    ScreenToggleDot(self->board->screen, 1);
+    ScreenToggleDot(self->board->screen, 2);
+    ScreenToggleDot(self->board->screen, 3);
+}
+
+static void request_work(app_t self, app_work_t work) {
+    if (self->notify != NULL) {
+        self->notify(self->notify_context, work);
+    }
+}
+
+static void request_render(app_t self) {
+    self->render_pending = true;
+    request_work(self, APP_WORK_RENDER);
+}
+
+static void enter_mode(app_t self, uint8_t from, uint8_t to, uint16_t divisor) {
+    self->inactivity_timer = 0;
+    DisplayFlashDigits(self->board->screen, from, to, divisor);
+}
+
+static void enter_unconfigured(void * context) {
+    app_t self = context;
+
+    enter_mode(self, 0, 3, DISPLAY_FLASH_FREQUENCY);
+    request_render(self);
+}
+
+static void enter_show_time(void * context) {
+    app_t self = context;
+
+    enter_mode(self, 0, 0, 0);
+    request_render(self);
+}
+
+static void enter_set_minutes(void * context) {
+    enter_mode(context, 2, 3, DISPLAY_FLASH_FREQUENCY);
+}
+
+static void enter_set_hours(void * context) {
+    enter_mode(context, 0, 1, DISPLAY_FLASH_FREQUENCY);
+}
+
+static void enter_set_alarm_minutes(void * context) {
+    enter_set_minutes(context);
+    toggle_alarm_dots(context);
+}
+
+static void enter_set_alarm_hours(void * context) {
+    enter_set_hours(context);
+    toggle_alarm_dots(context);
+}
+
+static uint8_t edit_time(void * context, uint8_t next) {
+    app_t self = context;
+
+    if (ClockGetTime(self->clock, &self->current_time_data)) {
+        clock_convert_time_to_bcd(&self->current_time_data, self->digits);
+    } else {
+        // si no está configurado, arrancar de 00:00
+        self->digits[0] = self->digits[1] = self->digits[2] = self->digits[3] = 0;
+    }
+    ScreenWriteBCD(self->board->screen, self->digits, sizeof(self->digits));
+    return next;
+}
+
+static uint8_t edit_alarm(void * context, uint8_t next) {
+    app_t self = context;
+
+    if (ClockGetAlarm(self->clock, &self->alarm_time_data)) {
+        clock_convert_time_to_bcd(&self->alarm_time_data, self->digits);
+    } else {
+        self->digits[0] = self->digits[1] = self->digits[2] = self->digits[3] = 0;
+    }
+    ScreenWriteBCD(self->board->screen, self->digits, sizeof(self->digits));
+    return next;
+}
+
+static uint8_t store_time(void * context, uint8_t next) {
+    app_t self = context;
+
+    clock_convert_bcd_to_time(&self->current_time_data, self->digits);
+    ClockSetTime(self->clock, &self->current_time_data);
+    return next;
+}
+
+static uint8_t store_alarm(void * context, uint8_t next) {
+    app_t self = context;
+
+    clock_convert_bcd_to_time(&self->alarm_time_data, self->digits);
+    ClockSetAlarm(self->clock, &self->alarm_time_data);
+    return next;
+}
+
+static uint8_t leave_time_edit(void * context, uint8_t next) {
+    app_t self = context;
+
+    (void)next;
+    return ClockGetTime(self->clock, &self->current_time_data) ? SHOW_TIME : UNCONFIGURED;
+}
+
+static uint8_t snooze_alarm(void * context, uint8_t next) {
+    app_t self = context;
+
+    if (ClockSetAlarm(self->clock, &self->alarm_time_data)) {
+        ClockIsAlarmEnabled(self->clock);
+    }
+    if (ClockIsAlarmActive(self->clock)) {
+        ClockSnoozeAlarm(self->clock);
+    }
+    request_render(self);
+    return next;
+}
+
+static uint8_t cancel_alarm(void * context, uint8_t next) {
+    app_t self = context;
+
+    if (ClockIsAlarmActive(self->clock)) {
+        ClockPostponeAlarmToNextDay(self->clock);
+        ScreenSetDot(self->board->screen, 3, true);
+    } else if (ClockIsAlarmEnabled(self->clock)) {
+        ClockDisableAlarm(self->clock);
+    }
+    request_render(self);
+    return next;
+}
+
+static uint8_t decrement_minutes(void * context, uint8_t next) {
+    app_t self = context;
+
+    clock_decrement_bcd(&self->digits[3], &self->digits[2], 9, 5);
+    show_adjusted(self);
+    return next;
+}
+
+static uint8_t increment_minutes(void * context, uint8_t next) {
+    app_t self = context;
+
+    clock_increment_bcd(&self->digits[3], &self->digits[2], 9, 5);
+    show_adjusted(self);
+    return next;
+}
+
+static uint8_t decrement_hours(void * context, uint8_t next) {
+    app_t self = context;
+
+    clock_decrement_bcd(&self->digits[1], &self->digits[0], 3, 2);
+    show_adjusted(self);
+    return next;
+}
+
+static uint8_t increment_hours(void * context, uint8_t next) {
+    app_t self = context;
+
+    clock_increment_bcd(&self->digits[1], &self->digits[0], 3, 2);
+    show_adjusted(self);
+    return next;
+}
+
+static void show_adjusted(app_t self) {
+    uint8_t mode = FsmGetState(self->modes);
+
+    self->inactivity_timer = 0;
+    ScreenWriteBCD(self->board->screen, self->digits, sizeof(self->digits));
+    if ((mode == SET_ALARM_MINUTE) || (mode == SET_ALARM_HOUR)) {
+        toggle_alarm_dots(self);
+    }
+}
+
+static void render_frame(app_t self) {
+    clock_time_t time;
+    uint8_t mode = FsmGetState(self->modes);
+    uint8_t dots;
+
+    if (mode == SHOW_TIME) {
+        if (ClockGetTime(self->clock, &time)) {
+            clock_convert_time_to_bcd(&time, self->digits);
+        }
+        dots = (self->flash_counter >= 500) ? (1 << 1) : 0;
+        if (ClockIsAlarmEnabled(self->clock)) {
+            dots |= (1 << 3);
+        }
+        if (ClockIsAlarmActive(self->clock)) {
+            dots |= (1 << 0);
+        }
+    } else if (mode == UNCONFIGURED) {
+        self->digits[0] = self->digits[1] = self->digits[2] = self->digits[3] = 0;
+        dots = (1 << 1);
+    } else {
+        // los modos de ajuste escriben los dígitos al cambiarlos
+        return;
+    }
+    ScreenPublishBCD(self->board->screen, self->digits, sizeof(self->digits), dots);
+}
+
+static void clock_increment_bcd(uint8_t *units, uint8_t *tens, uint8_t max_units, uint8_t max_tens) {
+    (*units)++;
+    if (*units > 9) {
+        *units = 0;
+        (*tens)++;
+        if (*tens > max_tens) {
+            *tens = 0;
+            *units = 0;
+        }
+    }
+
+    if (*tens == max_tens && *units > max_units)
+    {
+        *tens = 0;
+        *units = 0;
+    }
+}
+
+static void clock_decrement_bcd(uint8_t *units, uint8_t *tens, uint8_t max_units, uint8_t max_tens) {
+    if (*units > 0) {
+        (*units)--;
+    } else {
+        if (*tens > 0) {
+            (*tens)--;
+            *units = 9;
+        } else {
+            *tens = max_tens;
+            *units = max_units;
+        }
+    }
+}
+
+static void clock_convert_time_to_bcd(clock_time_t *time, uint8_t digits[]) {
+     if (time && digits) {
+        digits[0] = time->bcd[5]; // Hora de decenas
+        digits[1] = time->bcd[4]; // Hora de unidades
+        digits[2] = time->bcd[3]; // Minuto de decenas
+        digits[3] = time->bcd[2]; // Minuto de unidades
+    }
+ }
+
+static void clock_convert_bcd_to_time(clock_time_t *time, uint8_t digits[]) {
+     if (time && digits) {
+        time->bcd[5] = digits[0]; // Hora de decenas
+        time->bcd[4] = digits[1]; // Hora de unidades
+        time->bcd[3] = digits[2]; // Minuto de decenas
+        time->bcd[2] = digits[3]; // Minuto de unidades
+        time->bcd[1] = 0;
+        time->bcd[0] = 0;
+    }
+}
+
+
+/* === Public function implementation ========================================================= */
+
+app_t AppCreate(board_t board) {
+    app_t self;
+
+    if ((board == NULL) || (instances_used >= APP_MAX_INSTANCES)) {
+        return NULL;
+    }
+    self = &instances[instances_used++];
+
+    self->board = board;
+    self->clock = ClockCreate(CLOCK_TICKS_PER_SECOND, AlarmaRinging);
+    self->gestures[GESTURE_KEY_SET_TIME] = GestureCreate(board->set_time, &GESTURE_CONFIG[GESTURE_KEY_SET_TIME]);
+    self->gestures[GESTURE_KEY_SET_ALARM] = GestureCreate(board->set_alarm, &GESTURE_CONFIG[GESTURE_KEY_SET_ALARM]);
+    self->gestures[GESTURE_KEY_DECREMENT] = GestureCreate(board->decrement, &GESTURE_CONFIG[GESTURE_KEY_DECREMENT]);
+    self->gestures[GESTURE_KEY_INCREMENT] = GestureCreate(board->increment, &GESTURE_CONFIG[GESTURE_KEY_INCREMENT]);
+    self->alarm_sound = PatternPlayerCreate(board->buzzer);
+    self->alarm_light = PatternPlayerCreate(board->led_red);
+    ScreenSetTickRate(board->screen, APP_SCANS_PER_SECOND);
+    self->modes = FsmCreate(&MODE_TABLE, UNCONFIGURED, self);
+
+    return self;
+}
+
+void AppSetNotify(app_t self, app_notify_t notify, void * context) {
+    self->notify = notify;
+    self->notify_context = context;
+}
+
+void AppProcess(app_t self) {
+    AppHandleKeys(self);
+    AppHandleAlarm(self);
+    AppRender(self);
+}
+
+void AppHandleKeys(app_t self) {
+    /* Cada entrada se consulta una sola vez y su evento se atiende indexando la tabla con el modo actual */
+    if (GestureGetEvent(self->gestures[GESTURE_KEY_SET_TIME]) == GESTURE_LONG_PRESS) {
+        dispatch_key(self, EVENT_SET_TIME);
+    }
+    if (GestureGetEvent(self->gestures[GESTURE_KEY_SET_ALARM]) == GESTURE_LONG_PRESS) {
+        dispatch_key(self, EVENT_SET_ALARM);
+    }
+    if (DigitalInputWasActivated(self->board->accept)) {
+        dispatch_key(self, EVENT_ACCEPT);
+    }
+    if (DigitalInputWasActivated(self->board->cancel)) {
+        dispatch_key(self, EVENT_CANCEL);
+    }
+    if (adjust_step_requested(self, GESTURE_KEY_DECREMENT)) {
+        dispatch_key(self, EVENT_DECREMENT);
+    }
+    if (adjust_step_requested(self, GESTURE_KEY_INCREMENT)) {
+        dispatch_key(self, EVENT_INCREMENT);
+    }
+
+    /* Los modos que no esperan al usuario ignoran el evento, se reinicia la cuenta para no repetirlo en cada vuelta */
+    if (self->inactivity_timer >= INACTIVITY_TIMEOUT_MS) {
+        self->inactivity_timer = 0;
+        FsmDispatch(self->modes, EVENT_TIMEOUT);
+    }
+
+    /* Si ninguna tecla pidió un cuadro nuevo no se va a publicar nada, no hay latencia que medir */
+    if (!self->render_pending) {
+        LATENCY_SETTLE();
+    }
+}
+
+void AppHandleAlarm(app_t self) {
+    /* La alarma se indica con secuencias que empiezan al sonar y se detienen al posponerla o cancelarla */
+    if (!ClockIsAlarmActive(self->clock) && PatternIsPlaying(self->alarm_sound)) {
+        PatternStop(self->alarm_sound);
+        PatternStop(self->alarm_light);
+    }
+}
+
+void AppRender(app_t self) {
+    /* El cuadro se arma en el programa principal y solo cuando cambió algo de lo que muestra */
+    if (self->render_pending) {
+        self->render_pending = false;
+        PROFILE_BEGIN(render);
+        render_frame(self);
+        PROFILE_END(render);
+    }
+}
+
+void AppScan(app_t self) {
+    PROFILE_BEGIN(screen_refresh);
+    ScreenRefresh(self->board->screen);
+    PROFILE_END(screen_refresh);
+}
+
+void AppTick(app_t self) {
+    bool new_second;
+    bool keys_pending = false;
+
+    PROFILE_BEGIN(clock_tick);
+    new_second = ClockNewTick(self->clock);
+    PROFILE_END(clock_tick);
+
+    /* Solo se marca qué cambió, el cuadro lo arma AppRender() fuera de la interrupción. El punto parpadea al ritmo
+     * de los segundos del reloj, y cada segundo nuevo puede traer otra hora o el inicio de la alarma. */
+    if (new_second) {
+        self->flash_counter = 0;
+        request_render(self);
+    } else if (self->flash_counter < 500) {
+        self->flash_counter += TICK_MS;
+        if (self->flash_counter >= 500) {
+            request_render(self);
+        }
+    }
+
+    /* Las secuencias de la alarma avanzan aquí y no en el barrido, que tiene la prioridad más alta y cambia de ritmo */
+    PatternTick(self->alarm_sound);
+    PatternTick(self->alarm_light);
+
+    /* Los LEDs y el zumbador solo acceden a su puerto si alguno cambió en este tick */
+    DigitalOutputGroupUpdate(self->board->leds);
+
+    /* Lee y filtra todas las teclas juntas a intervalos fijos, el programa principal solo consume los flancos */
+    self->keys_counter += TICK_MS;
+    if (self->keys_counter >= KEYS_SCAN_PERIOD_MS) {
+        keys_pending = DigitalInputGroupScan(self->board->keys);
+        for (int index = 0; index < GESTURE_KEYS_COUNT; index++) {
+            GestureTick(self->gestures[index], self->keys_counter);
+            keys_pending = GestureHasEvent(self->gestures[index]) || keys_pending;
+        }
+        self->keys_counter = 0;
+    }
+
+    /* Las teclas solo se atienden cuando hay algo nuevo, el tiempo de espera se pide hasta que se atienda */
+    self->inactivity_timer += TICK_MS;
+    if (keys_pending || (self->inactivity_timer >= INACTIVITY_TIMEOUT_MS)) {
+        request_work(self, APP_WORK_KEYS);
+    }
+}
+
+/* === End of documentation ==================================================================== */
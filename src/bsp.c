@@ -27,21 +27,68 @@ SPDX-License-Identifier: MIT
 #include "chip.h"
 #include "digital.h"
 #include <stdbool.h>
+#include <stddef.h>
 #include "poncho.h"
 #include "screen.h"
 #include "edu_ciaa.h"
-#include <stdlib.h>
 
 
 /* === Macros definitions ========================================================================================== */
 
+/* Si el punto decimal comparte el puerto con los segmentos se escribe en la misma palabra */
+#if (SEGMENT_P_GPIO == SEGMENTS_GPIO) && (SCREEN_SEGMENT_P_BIT == SEGMENT_P_BIT)
+#define SEGMENTS_WORD_MASK (SEGMENTS_MASK | SEGMENT_P_MASK)
+#else
+#define SEGMENTS_WORD_MASK SEGMENTS_MASK
+#define SEGMENT_P_SEPARATE
+#endif
+
+/* Modos eléctricos de los pines de la placa */
+#define PIN_MODE_OUTPUT  (SCU_MODE_INBUFF_EN | SCU_MODE_INACT)   //!< Salida sin resistencias
+#define PIN_MODE_PULLUP  (SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP)  //!< Entrada con resistencia a positivo
+#define PIN_MODE_INPUT   (SCU_MODE_INBUFF_EN | SCU_MODE_INACT)   //!< Entrada sin resistencias
+
+/** Salida de la tabla de pines, con el nivel inicial del pin, a partir de las definiciones NAME_* de la placa */
+#define BOARD_OUTPUT(NAME, LEVEL)                                                                                      \
+    {NAME##_PORT, NAME##_PIN, PIN_MODE_OUTPUT | NAME##_FUNC, NAME##_GPIO, NAME##_BIT, true, LEVEL}
+
+/** Entrada de la tabla de pines, con el modo eléctrico, a partir de las definiciones NAME_* de la placa */
+#define BOARD_INPUT(NAME, MODE) {NAME##_PORT, NAME##_PIN, (MODE) | NAME##_FUNC, NAME##_GPIO, NAME##_BIT, false, false}
+
+#define BOARD_GPIO_PORTS 8 //!< Cantidad de puertos GPIO del microcontrolador
+
+#define BOARD_SCAN_PRIORITY 0                              //!< Prioridad del barrido, la más alta del NVIC
+#define BOARD_TICK_PRIORITY ((1 << __NVIC_PRIO_BITS) - 1)  //!< Prioridad del tiempo, la más baja del NVIC
+
+#ifndef BOARD_MAX_INSTANCES
+#define BOARD_MAX_INSTANCES 1 //!< Cantidad máxima de placas, más de una solo tiene sentido en los simuladores de la PC
+#endif
+
 /* === Private data type declarations ============================================================================== */
 
-/* === Private function declarations =============================================================================== */
+/*! Descripción de un pin de la placa */
+typedef struct board_pin_s {
+    uint8_t port;   //!< Grupo de pines del SCU
+    uint8_t pin;    //!< Pin dentro del grupo del SCU
+    uint16_t mode;  //!< Modo eléctrico y función del pin
+    uint8_t gpio;   //!< Puerto GPIO de la función de entrada y salida
+    uint8_t bit;    //!< Bit dentro del puerto GPIO
+    bool output;    //!< Indica si el pin es una salida
+    bool level;     //!< Nivel inicial de una salida
+} board_pin_t;
 
-static void DigitsInit(void);
+/* === Private function declarations =============================================================================== */
 
-static void SegmentsInit(void);
+/**
+ * @brief Configura todos los pines de una tabla
+ *
+ * Cada pin necesita su propia escritura en el SCU, pero los niveles y las direcciones se acumulan por puerto GPIO y se
+ * escriben al final con una escritura en los registros de set, clear y dirección de cada puerto usado.
+ *
+ * @param pins Tabla de pines a configurar
+ * @param count Cantidad de pines de la tabla
+ */
+static void BoardPinsInit(const board_pin_t pins[], uint8_t count);
 
 static void DigitsTurnOff(void);
 
@@ -49,79 +96,126 @@ static void SegmentsUpdate(uint8_t value);
 
 static void DigitTurnOn(uint8_t digit);
 
+/**
+ * @brief Reprograma el temporizador de barrido con la frecuencia que pide la pantalla
+ *
+ * @param ticks Cantidad de interrupciones por segundo, cero para detener el temporizador
+ */
+static void ScanRateSet(uint16_t ticks);
+
+/**
+ * @brief Programa el SysTick con la frecuencia pedida por la pantalla, se llama con las interrupciones bloqueadas
+ */
+static void ScanTimerProgram(void);
+
 /* === Private variable definitions ================================================================================ */
 
+//! Pines de la placa. Para usar otra placa alcanza con cambiar esta tabla y poncho.h
+static const board_pin_t BOARD_PINS[] = {
+    BOARD_OUTPUT(DIGIT_1, false),
+    BOARD_OUTPUT(DIGIT_2, false),
+    BOARD_OUTPUT(DIGIT_3, false),
+    BOARD_OUTPUT(DIGIT_4, false),
+    BOARD_OUTPUT(SEGMENT_A, false),
+    BOARD_OUTPUT(SEGMENT_B, false),
+    BOARD_OUTPUT(SEGMENT_C, false),
+    BOARD_OUTPUT(SEGMENT_D, false),
+    BOARD_OUTPUT(SEGMENT_E, false),
+    BOARD_OUTPUT(SEGMENT_F, false),
+    BOARD_OUTPUT(SEGMENT_G, false),
+    BOARD_OUTPUT(SEGMENT_P, false),
+    BOARD_OUTPUT(RGB_RED, true),   // El LED RGB es activo bajo
+    BOARD_OUTPUT(RGB_GREEN, true),
+    BOARD_OUTPUT(RGB_BLUE, true),
+    BOARD_OUTPUT(BUZZER, false),
+    BOARD_INPUT(KEY_F1, PIN_MODE_PULLUP),
+    BOARD_INPUT(KEY_F2, PIN_MODE_PULLUP),
+    BOARD_INPUT(KEY_F3, PIN_MODE_PULLUP),
+    BOARD_INPUT(KEY_F4, PIN_MODE_PULLUP),
+    BOARD_INPUT(KEY_ACCEPT, PIN_MODE_INPUT),
+    BOARD_INPUT(KEY_CANCEL, PIN_MODE_INPUT),
+};
+
 static const struct screen_driver_s screen_driver = {
   .DigitsTurnOff = DigitsTurnOff,
   .SegmentsUpdate = SegmentsUpdate,
   .DigitTurnOn = DigitTurnOn,
+  .ScanRateSet = ScanRateSet,
 };
 
-/* === Public variable definitions ================================================================================= */
-
-/* === Private function definitions ================================================================================ */
-
-static void DigitsInit(void){
-    Chip_SCU_PinMuxSet(DIGIT_1_PORT, DIGIT_1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_1_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_1_GPIO, DIGIT_1_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_1_GPIO, DIGIT_1_BIT, true);
+//! Función que atiende el temporizador de barrido, NULL mientras no se arrancó
+static board_timer_handler_t scan_handler;
 
-    Chip_SCU_PinMuxSet(DIGIT_2_PORT, DIGIT_2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_2_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_2_GPIO, DIGIT_2_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_2_GPIO, DIGIT_2_BIT, true);
-
-    Chip_SCU_PinMuxSet(DIGIT_3_PORT, DIGIT_3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_3_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_3_GPIO, DIGIT_3_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_3_GPIO, DIGIT_3_BIT, true);
-
-    Chip_SCU_PinMuxSet(DIGIT_4_PORT, DIGIT_4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | DIGIT_4_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, DIGIT_4_GPIO, DIGIT_4_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, DIGIT_4_GPIO, DIGIT_4_BIT, true);
-}
+//! Interrupciones por segundo del temporizador de barrido pedidas por la pantalla, cero si está detenido
+static uint16_t scan_rate;
 
-static void SegmentsInit(void){
-    Chip_SCU_PinMuxSet(SEGMENT_A_PORT, SEGMENT_A_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_A_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_A_GPIO, SEGMENT_A_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_A_GPIO, SEGMENT_A_BIT, true);
+//! Función que atiende el temporizador de tiempo, NULL mientras no se arrancó
+static board_timer_handler_t tick_handler;
 
-    Chip_SCU_PinMuxSet(SEGMENT_B_PORT, SEGMENT_B_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_B_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_B_GPIO, SEGMENT_B_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_B_GPIO, SEGMENT_B_BIT, true);
-
-    Chip_SCU_PinMuxSet(SEGMENT_C_PORT, SEGMENT_C_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_C_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_C_GPIO, SEGMENT_C_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_C_GPIO, SEGMENT_C_BIT, true);
-
-    Chip_SCU_PinMuxSet(SEGMENT_D_PORT, SEGMENT_D_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_D_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_D_GPIO, SEGMENT_D_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_D_GPIO, SEGMENT_D_BIT, true);
+/* === Public variable definitions ================================================================================= */
 
-    Chip_SCU_PinMuxSet(SEGMENT_E_PORT, SEGMENT_E_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_E_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_E_GPIO, SEGMENT_E_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_E_GPIO, SEGMENT_E_BIT, true);
+/* === Private function definitions ================================================================================ */
 
-    Chip_SCU_PinMuxSet(SEGMENT_F_PORT, SEGMENT_F_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_F_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_F_GPIO, SEGMENT_F_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_F_GPIO, SEGMENT_F_BIT, true);
+static void BoardPinsInit(const board_pin_t pins[], uint8_t count){
+    uint32_t set[BOARD_GPIO_PORTS] = {0};
+    uint32_t clear[BOARD_GPIO_PORTS] = {0};
+    uint32_t outputs[BOARD_GPIO_PORTS] = {0};
+    uint32_t inputs[BOARD_GPIO_PORTS] = {0};
+
+    for (uint8_t index = 0; index < count; index++)
+    {
+        const board_pin_t * pin = &pins[index];
+
+        Chip_SCU_PinMuxSet(pin->port, pin->pin, pin->mode);
+        if (!pin->output)
+        {
+            inputs[pin->gpio] |= (1UL << pin->bit);
+        }else if (pin->level)
+        {
+            outputs[pin->gpio] |= (1UL << pin->bit);
+            set[pin->gpio] |= (1UL << pin->bit);
+        }else
+        {
+            outputs[pin->gpio] |= (1UL << pin->bit);
+            clear[pin->gpio] |= (1UL << pin->bit);
+        }
+    }
 
-    Chip_SCU_PinMuxSet(SEGMENT_G_PORT, SEGMENT_G_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_G_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_G_GPIO, SEGMENT_G_BIT, true);
+    /* Los niveles se escriben antes de la dirección para que las salidas no arranquen con un valor anterior */
+    for (uint8_t gpio = 0; gpio < BOARD_GPIO_PORTS; gpio++)
+    {
+        if (set[gpio])
+        {
+            Chip_GPIO_SetValue(LPC_GPIO_PORT, gpio, set[gpio]);
+        }
+        if (clear[gpio])
+        {
+            Chip_GPIO_ClearValue(LPC_GPIO_PORT, gpio, clear[gpio]);
+        }
+        if (outputs[gpio])
+        {
+            Chip_GPIO_SetPortDIROutput(LPC_GPIO_PORT, gpio, outputs[gpio]);
+        }
+        if (inputs[gpio])
+        {
+            Chip_GPIO_SetPortDIRInput(LPC_GPIO_PORT, gpio, inputs[gpio]);
+        }
+    }
 
-    Chip_SCU_PinMuxSet(SEGMENT_P_PORT, SEGMENT_P_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | SEGMENT_P_FUNC);
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, false);
-    Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, true);
+    /* Las escrituras enmascaradas del puerto solo modifican los bits de los segmentos */
+    Chip_GPIO_SetPortMask(LPC_GPIO_PORT, SEGMENTS_GPIO, ~SEGMENTS_WORD_MASK);
 }
 
 static void DigitsTurnOff(void){
   Chip_GPIO_ClearValue(LPC_GPIO_PORT, DIGITS_GPIO, DIGITS_MASK);
-  Chip_GPIO_ClearValue(LPC_GPIO_PORT, SEGMENTS_GPIO, SEGMENTS_MASK);
-  Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, false);
 }
 
 static void SegmentsUpdate(uint8_t value){
-  Chip_GPIO_SetValue(LPC_GPIO_PORT, SEGMENTS_GPIO, (value & SEGMENTS_MASK));
+  /* La palabra ya viene en el orden del puerto, la máscara del puerto descarta el bit del punto si está en otro */
+  Chip_GPIO_SetMaskedPortValue(LPC_GPIO_PORT, SEGMENTS_GPIO, value);
+#ifdef SEGMENT_P_SEPARATE
   Chip_GPIO_SetPinState(LPC_GPIO_PORT, SEGMENT_P_GPIO, SEGMENT_P_BIT, (value & SEGMENT_P));
+#endif
 }
 
 
@@ -129,53 +223,111 @@ static void DigitTurnOn(uint8_t digit){
   Chip_GPIO_SetValue(LPC_GPIO_PORT, DIGITS_GPIO, (1 << (3 - digit)) & DIGITS_MASK);
 }
 
+static void ScanRateSet(uint16_t ticks){
+    uint32_t primask = __get_PRIMASK();
+
+    /* Antes de arrancar el temporizador solo se recuerda, BoardScanTimerStart() lo programa después */
+    __disable_irq();
+    scan_rate = ticks;
+    if (scan_handler != NULL) {
+        ScanTimerProgram();
+    }
+    __set_PRIMASK(primask);
+}
+
+static void ScanTimerProgram(void){
+    if (scan_rate == 0) {
+        SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+        return;
+    }
+    /* SysTick_Config() deja la interrupción con la prioridad más baja, se vuelve a subir cada vez */
+    SysTick_Config(SystemCoreClock / scan_rate);
+    NVIC_SetPriority(SysTick_IRQn, BOARD_SCAN_PRIORITY);
+}
+
 /* === Public function implementation ============================================================================== */
 
 board_t BoardCreate(void){
-    struct board_s * board = malloc(sizeof(struct board_s));
-    if (board != NULL){ 
-      DigitsInit();
-      SegmentsInit();
-      board->screen = ScreenCreate(4, &screen_driver);
+    static struct board_s instances[BOARD_MAX_INSTANCES];
+    static uint16_t used = 0;
+    struct board_s * board;
 
-      Chip_SCU_PinMuxSet(RGB_RED_PORT, RGB_RED_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | RGB_RED_FUNC);
-      board->led_red = DigitalOutputCreate(RGB_RED_GPIO, RGB_RED_BIT, true);
+    if (used >= BOARD_MAX_INSTANCES) {
+        return NULL;
+    }
+    board = &instances[used++];
 
-      Chip_SCU_PinMuxSet(RGB_GREEN_PORT, RGB_GREEN_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | RGB_GREEN_FUNC);
-      board->led_green = DigitalOutputCreate(RGB_GREEN_GPIO, RGB_GREEN_BIT, true);
+    BoardPinsInit(BOARD_PINS, sizeof(BOARD_PINS) / sizeof(BOARD_PINS[0]));
+    board->screen = ScreenCreate(4, &screen_driver);
 
-      Chip_SCU_PinMuxSet(RGB_BLUE_PORT, RGB_BLUE_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | RGB_BLUE_FUNC);
-      board->led_blue = DigitalOutputCreate(RGB_BLUE_GPIO, RGB_BLUE_BIT, true);
-     
+    /* Los cambios de los LEDs y del zumbador se escriben juntos con DigitalOutputGroupUpdate() */
+    board->leds = DigitalOutputGroupCreate();
 
-      Chip_SCU_PinMuxSet(KEY_F1_PORT, KEY_F1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F1_FUNC);
-      board->set_time = DigitalInputCreate(KEY_F1_GPIO, KEY_F1_BIT, false);
+    board->led_red = DigitalOutputGroupAdd(board->leds, RGB_RED_GPIO, RGB_RED_BIT, true);
 
-      Chip_SCU_PinMuxSet(KEY_F2_PORT, KEY_F2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F2_FUNC);
-      board->set_alarm = DigitalInputCreate(KEY_F2_GPIO, KEY_F2_BIT, false);
+    board->led_green = DigitalOutputGroupAdd(board->leds, RGB_GREEN_GPIO, RGB_GREEN_BIT, true);
 
-      Chip_SCU_PinMuxSet(KEY_F3_PORT, KEY_F3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F3_FUNC);
-      board->decrement = DigitalInputCreate(KEY_F3_GPIO, KEY_F3_BIT, false);
+    board->led_blue = DigitalOutputGroupAdd(board->leds, RGB_BLUE_GPIO, RGB_BLUE_BIT, true);
 
-      Chip_SCU_PinMuxSet(KEY_F4_PORT, KEY_F4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | KEY_F4_FUNC);
-      board->increment = DigitalInputCreate(KEY_F4_GPIO, KEY_F4_BIT, false);
+    board->buzzer = DigitalOutputGroupAdd(board->leds, BUZZER_GPIO, BUZZER_BIT, false);
 
-      Chip_SCU_PinMuxSet(KEY_ACCEPT_PORT, KEY_ACCEPT_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_ACCEPT_FUNC);
-      board->accept = DigitalInputCreate(KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT, false);
+    /* Las teclas conectan el pin a masa, se invierten para que la entrada esté activa mientras se presionan */
+    board->keys = DigitalInputGroupCreate();
 
-      Chip_SCU_PinMuxSet(KEY_CANCEL_PORT, KEY_CANCEL_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_CANCEL_FUNC);
-      board->cancel = DigitalInputCreate(KEY_CANCEL_GPIO, KEY_CANCEL_BIT, false);
-    }
+    board->set_time = DigitalInputGroupAdd(board->keys, KEY_F1_GPIO, KEY_F1_BIT, true);
+
+    board->set_alarm = DigitalInputGroupAdd(board->keys, KEY_F2_GPIO, KEY_F2_BIT, true);
+
+    board->decrement = DigitalInputGroupAdd(board->keys, KEY_F3_GPIO, KEY_F3_BIT, true);
+
+    board->increment = DigitalInputGroupAdd(board->keys, KEY_F4_GPIO, KEY_F4_BIT, true);
+
+    board->accept = DigitalInputGroupAdd(board->keys, KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT, true);
+
+    board->cancel = DigitalInputGroupAdd(board->keys, KEY_CANCEL_GPIO, KEY_CANCEL_BIT, true);
 
     return board;
 }
 
-void SysTickInit(uint16_t ticks) {
-    __asm volatile("cpsid i"); 
-    SystemCoreClockUpdate(); 
-    SysTick_Config(SystemCoreClock / ticks); 
-    NVIC_SetPriority(SysTick_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
-    
-    __asm volatile("cpsie i"); // Habilita las interrupciones
+void BoardScanTimerStart(board_timer_handler_t handler) {
+    __disable_irq();
+    scan_handler = handler;
+    SystemCoreClockUpdate();
+    ScanTimerProgram();
+    __enable_irq();
 }
+
+int BoardTickTimerStart(uint16_t ticks, board_timer_handler_t handler) {
+    uint32_t rate = Chip_Clock_GetRate(CLK_MX_RITIMER);
+
+    /* El período se cuenta en ciclos del reloj del RIT, así cualquier frecuencia hasta la del reloj es válida */
+    if ((ticks == 0) || (ticks > rate)) {
+        return -1;
+    }
+
+    __disable_irq();
+    tick_handler = handler;
+    Chip_RIT_Init(LPC_RITIMER);
+    Chip_RIT_SetCOMPVAL(LPC_RITIMER, rate / ticks);
+    Chip_RIT_EnableCTRL(LPC_RITIMER, RIT_CTRL_ENCLR);
+    NVIC_SetPriority(RITIMER_IRQn, BOARD_TICK_PRIORITY);
+    NVIC_ClearPendingIRQ(RITIMER_IRQn);
+    NVIC_EnableIRQ(RITIMER_IRQn);
+    __enable_irq();
+    return 0;
+}
+
+void SysTick_Handler(void) {
+    if (scan_handler != NULL) {
+        scan_handler();
+    }
+}
+
+void RIT_IRQHandler(void) {
+    Chip_RIT_ClearInt(LPC_RITIMER);
+    if (tick_handler != NULL) {
+        tick_handler();
+    }
+}
+
 /* === End of documentation ======================================================================================== */
@@ -24,11 +24,17 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "clock.h"
+#include "profile.h"
+#include "trace.h"
 #include <stddef.h>
 #include <string.h>
 
 /* === Macros definitions ========================================================================================== */
 
+#ifndef CLOCK_MAX_INSTANCES
+#define CLOCK_MAX_INSTANCES 1 //!< Cantidad máxima de relojes, reservados en memoria estática
+#endif
+
 /* === Private data type declarations ============================================================================== */
 
 /* === Private function declarations =============================================================================== */
@@ -121,6 +127,7 @@ static void AdvanceTime(clock_t self) {
     if (self->alarm_enabled && self->valid_alarm && !self->alarm_cancelled_today) {
         if (memcmp(t->bcd, self->alarm_time.bcd, sizeof(t->bcd)) == 0) {
             if (!self->alarm_ringing) {
+                TRACE(TRACE_ALARM_FIRE, 0);
                 self->alarm_ringing = true;
                 if (self->callback) {
                     self->callback(self);
@@ -148,8 +155,14 @@ static void PosponeAlarm(clock_t self, uint8_t minutes) {
 }
 /* === Public function implementation ============================================================================== */
 clock_t ClockCreate(uint16_t ticks_per_second, clock_alarm_callback_t callback){
-    
-    static struct clock_s self[1];
+    static struct clock_s instances[CLOCK_MAX_INSTANCES];
+    static uint16_t used = 0;
+    clock_t self;
+
+    if (used >= CLOCK_MAX_INSTANCES) {
+        return NULL;
+    }
+    self = &instances[used++];
     memset(self, 0, sizeof(struct clock_s));
     self->ticks_per_second = ticks_per_second;
     self->callback = callback;
@@ -185,14 +198,18 @@ bool ClockSetTime(clock_t self, const clock_time_t * new_time){
     return self->valid_time;
 }
 
-void ClockNewTick(clock_t self){
+bool ClockNewTick(clock_t self){
     self->clock_ticks++;
     if (self->clock_ticks < self->ticks_per_second) {
-        return;
+        return false;
     }
     self->clock_ticks = 0;
 
+    PROFILE_BEGIN(advance_time);
     AdvanceTime(self);
+    PROFILE_END(advance_time);
+    TRACE(TRACE_CLOCK_SECOND, (self->current_time.time.seconds[1] << 4) | self->current_time.time.seconds[0]);
+    return true;
 }
 
 bool ClockSetAlarm(clock_t self, const clock_time_t * alarm_time){
@@ -227,6 +244,7 @@ void ClockDisableAlarm(clock_t self) {
 
 void ClockSnoozeAlarm(clock_t self) {
    if (!self || !self->alarm_ringing) return;
+    TRACE(TRACE_ALARM_SNOOZE, 0);
     self->alarm_ringing = false;
     PosponeAlarm(self, 5);
 }
@@ -250,6 +268,7 @@ void ClockPostponeAlarmToNextDay(clock_t self) {
     
     SyncBcdFromTime(&self->alarm_time);
     
+    TRACE(TRACE_ALARM_POSTPONE, 0);
     self->alarm_ringing = false;
     self->alarm_cancelled_today = true;
     self->alarm_enabled = true;
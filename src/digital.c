@@ -27,20 +27,87 @@ SPDX-License-Identifier: MIT
 #include <stdbool.h>
 #include <stdio.h>
 #include "chip.h"
-#include <stdlib.h>
 #include <string.h>
 #include "poncho.h"
+#include "trace.h"
 
 /* === Macros definitions ========================================================================================== */
 
+#ifndef DIGITAL_GROUP_MAX_PORTS
+#define DIGITAL_GROUP_MAX_PORTS 3 //!< Cantidad máxima de puertos GPIO distintos en un grupo de entradas o de salidas
+#endif
+
+/* Cantidad de objetos de cada tipo que se pueden crear, reservados en memoria estática. Los valores por defecto son
+ * los que usa la placa del reloj. */
+#ifndef DIGITAL_OUTPUTS_MAX
+#define DIGITAL_OUTPUTS_MAX 4 //!< Cantidad máxima de salidas digitales
+#endif
+
+#ifndef DIGITAL_INPUTS_MAX
+#define DIGITAL_INPUTS_MAX 6 //!< Cantidad máxima de entradas digitales
+#endif
+
+#ifndef DIGITAL_OUTPUT_GROUPS_MAX
+#define DIGITAL_OUTPUT_GROUPS_MAX 1 //!< Cantidad máxima de grupos de salidas digitales
+#endif
+
+#ifndef DIGITAL_INPUT_GROUPS_MAX
+#define DIGITAL_INPUT_GROUPS_MAX 1 //!< Cantidad máxima de grupos de entradas digitales
+#endif
 
 /* === Private data type declarations ============================================================================== */
 
+/*! Estado de un puerto escrito por un grupo de salidas, cada bit corresponde al pin del mismo número */
+struct digital_output_port_s {
+    uint8_t gpio;   /*!< Puerto GPIO escrito */
+    uint32_t mask;  /*!< Pines del puerto que pertenecen al grupo */
+    uint32_t level; /*!< Nivel escrito en los pines en la última actualización */
+    uint32_t next;  /*!< Nivel pedido para los pines en la próxima actualización */
+};
+
 /*! Estructura que representa una salida digital */
 struct digital_output_s {
     uint8_t gpio; /*!< Puerto al que pertenece la salida */
     uint8_t bit;  /*!< Bit al que pertenece la salida */
     bool state;   //!< Estado inicial de la salida
+    bool active;  //!< Estado lógico actual de la salida
+    digital_output_stats_t stats[1]; //!< Escrituras realizadas y evitadas
+    struct digital_output_port_s * port; //!< Estado del puerto en el grupo, NULL si la salida se escribe directamente
+};
+
+/*! Estructura que representa un grupo de salidas digitales */
+struct digital_output_group_s {
+    uint8_t ports;                                              /*!< Cantidad de puertos usados */
+    struct digital_output_port_s port[DIGITAL_GROUP_MAX_PORTS]; /*!< Estado de cada puerto */
+    digital_output_stats_t stats[1];                            /*!< Escrituras realizadas y evitadas */
+};
+
+/*! Estado de un puerto leído por un grupo de entradas, cada bit corresponde al pin del mismo número */
+struct digital_port_s {
+    uint8_t gpio;         /*!< Puerto GPIO leído */
+    uint32_t mask;        /*!< Pines del puerto que pertenecen al grupo */
+    uint32_t inverted;    /*!< Pines cuyo nivel se invierte para obtener el estado lógico */
+    uint32_t active;      /*!< Estado lógico filtrado de los pines */
+    uint32_t count0;      /*!< Bit bajo de los contadores verticales de cada pin */
+    uint32_t count1;      /*!< Bit alto de los contadores verticales de cada pin */
+    uint32_t activated;   /*!< Pines con un flanco de activación pendiente de consultar */
+    uint32_t deactivated; /*!< Pines con un flanco de desactivación pendiente de consultar */
+};
+
+/*! Estado de las entradas con flancos detectados por interrupción */
+struct digital_events_s {
+    digital_timestamp_t timestamp;                         /*!< Función que devuelve la marca de tiempo */
+    digital_notify_t notify;                               /*!< Función que avisa cada flanco guardado */
+    digital_input_t channel[DIGITAL_EVENTS_CHANNELS];      /*!< Entrada asignada a cada canal de interrupción */
+    digital_event_t queue[DIGITAL_EVENTS_QUEUE_LENGTH];    /*!< Flancos pendientes de consultar */
+    volatile uint8_t head;                                 /*!< Posición donde se guarda el próximo flanco */
+    volatile uint8_t tail;                                 /*!< Posición del próximo flanco a consultar */
+};
+
+/*! Estructura que representa un grupo de entradas digitales */
+struct digital_input_group_s {
+    uint8_t ports;                                       /*!< Cantidad de puertos usados */
+    struct digital_port_s port[DIGITAL_GROUP_MAX_PORTS]; /*!< Estado de cada puerto */
 };
 
 /*! Estrucutura que representa una entrada digital*/
@@ -50,22 +117,114 @@ struct digital_input_s
     uint8_t bit;  /*!< Bit al que pertenece la entrada */
     bool inverted;/*!< Indica si la entrada es invertida o no */
     bool lastState; /*!< Último estado leído de la entrada, usado para detectar cambios */
+    struct digital_port_s * port; /*!< Estado del puerto en el grupo, NULL si la entrada se lee directamente */
 };
 
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief Cambia el estado lógico de una salida, accediendo al puerto solo si el estado cambia
+ * 
+ * @param self Puntero a la salida digital
+ * @param active Estado lógico pedido
+ */
+static void DigitalOutputSetState(digital_output_t self, bool active);
+
+/**
+ * @brief Atiende la interrupción de un canal y guarda el flanco detectado en la cola
+ * 
+ * @param channel Canal de interrupción por pin
+ */
+static void DigitalEventsHandler(uint8_t channel);
+
 /* === Private variable definitions ================================================================================ */
 
+//! Entradas con flancos detectados por interrupción, los canales son únicos en el microcontrolador
+static struct digital_events_s events[1];
+
+//! Salidas digitales disponibles y cantidad ya creadas
+static struct digital_output_s outputs[DIGITAL_OUTPUTS_MAX];
+static uint16_t outputs_used;
+
+//! Entradas digitales disponibles y cantidad ya creadas
+static struct digital_input_s inputs[DIGITAL_INPUTS_MAX];
+static uint16_t inputs_used;
+
+//! Grupos de salidas disponibles y cantidad ya creados
+static struct digital_output_group_s output_groups[DIGITAL_OUTPUT_GROUPS_MAX];
+static uint16_t output_groups_used;
+
+//! Grupos de entradas disponibles y cantidad ya creados
+static struct digital_input_group_s input_groups[DIGITAL_INPUT_GROUPS_MAX];
+static uint16_t input_groups_used;
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
+static void DigitalOutputSetState(digital_output_t self, bool active) {
+    /* El nivel del pin con la salida inactiva es state */
+    bool level = active != self->state;
+
+    /* Se llama desde el programa principal y desde las interrupciones de barrido y de tiempo, el estado, las
+     * estadísticas y el pin cambian juntos */
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (active == self->active)
+    {
+        self->stats->skipped++;
+    }else
+    {
+        self->active = active;
+        self->stats->performed++;
+        if (self->port != NULL)
+        {
+            if (level)
+            {
+                self->port->next |= (1UL << self->bit);
+            }else
+            {
+                self->port->next &= ~(1UL << self->bit);
+            }
+        }else
+        {
+            Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->gpio, self->bit, level);
+        }
+    }
+    __set_PRIMASK(primask);
+}
+
+static void DigitalEventsHandler(uint8_t channel) {
+    digital_input_t input = events->channel[channel];
+    uint32_t pins = PININTCH(channel);
+    uint8_t head = (events->head + 1) % DIGITAL_EVENTS_QUEUE_LENGTH;
+    digital_event_t * event = &events->queue[events->head];
+
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, pins);
+    Chip_PININT_ClearRiseStates(LPC_GPIO_PIN_INT, pins);
+    Chip_PININT_ClearFallStates(LPC_GPIO_PIN_INT, pins);
+
+    /* Si un rebote generó ambos flancos, el nivel actual del pin indica cuál fue el último */
+    if ((input != NULL) && (head != events->tail)) {
+        event->input = input;
+        event->edge = (Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, input->gpio, input->bit) != input->inverted)
+                          ? DIGITAL_INPUT_WAS_ACTIVATED
+                          : DIGITAL_INPUT_WAS_DEACTIVATED;
+        event->timestamp = (events->timestamp != NULL) ? events->timestamp() : 0;
+        events->head = head;
+        if (events->notify != NULL) {
+            events->notify();
+        }
+    }
+}
+
 /* === Public function implementation ============================================================================== */
 
 digital_output_t DigitalOutputCreate(uint8_t gpio, uint8_t bit, bool state){
-    digital_output_t self = malloc(sizeof(struct digital_output_s));
-    if (self != NULL)
+    digital_output_t self = NULL;
+    if (outputs_used < DIGITAL_OUTPUTS_MAX)
     {
+        self = &outputs[outputs_used++];
         self ->gpio = gpio;
         self ->bit = bit;
         self->state = state;
@@ -76,23 +235,111 @@ digital_output_t DigitalOutputCreate(uint8_t gpio, uint8_t bit, bool state){
 } 
 
 void DigitalOutputActivate(digital_output_t self){
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT,self->gpio,self->bit,!self->state);
+    DigitalOutputSetState(self, true);
 }
 
 void DigitalOutputDeactivate(digital_output_t self){
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT,self->gpio,self->bit,self->state);
+    DigitalOutputSetState(self, false);
 }
 
 void DigitalOutputToggle(digital_output_t self){
-    Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, self->gpio, self->bit);
+    DigitalOutputSetState(self, !self->active);
+}
+
+bool DigitalOutputGetIsActive(digital_output_t self){
+    return self->active;
+}
+
+void DigitalOutputGetStats(digital_output_t self, digital_output_stats_t * stats){
+    *stats = *self->stats;
+}
+
+digital_output_group_t DigitalOutputGroupCreate(void){
+    digital_output_group_t self = NULL;
+    if (output_groups_used < DIGITAL_OUTPUT_GROUPS_MAX)
+    {
+        self = &output_groups[output_groups_used++];
+    }
+    return self;
+}
+
+digital_output_t DigitalOutputGroupAdd(digital_output_group_t group, uint8_t gpio, uint8_t bit, bool state){
+    struct digital_output_port_s * port = NULL;
+    digital_output_t self = NULL;
+
+    for (uint8_t index = 0; index < group->ports; index++)
+    {
+        if (group->port[index].gpio == gpio)
+        {
+            port = &group->port[index];
+        }
+    }
+    if ((port == NULL) && (group->ports < DIGITAL_GROUP_MAX_PORTS))
+    {
+        port = &group->port[group->ports++];
+        port->gpio = gpio;
+    }
+
+    if (port != NULL)
+    {
+        self = DigitalOutputCreate(gpio, bit, state);
+    }
+    if (self != NULL)
+    {
+        self->port = port;
+        port->mask |= (1UL << bit);
+        if (state)
+        {
+            port->level |= (1UL << bit);
+            port->next |= (1UL << bit);
+        }
+    }
+    return self;
+}
+
+void DigitalOutputGroupUpdate(digital_output_group_t self){
+    struct digital_output_port_s * port;
+    uint32_t next;
+    uint32_t changed;
+
+    for (uint8_t index = 0; index < self->ports; index++)
+    {
+        port = &self->port[index];
+        /* Una sola lectura del nivel pedido, que puede cambiar desde una interrupción */
+        next = port->next;
+        changed = (next ^ port->level) & port->mask;
+        if (changed == 0)
+        {
+            self->stats->skipped++;
+            continue;
+        }
+
+        /* Los registros de set y clear solo afectan los bits en uno, no hace falta la máscara del puerto */
+        if (changed & next)
+        {
+            Chip_GPIO_SetValue(LPC_GPIO_PORT, port->gpio, changed & next);
+        }
+        if (changed & ~next)
+        {
+            Chip_GPIO_ClearValue(LPC_GPIO_PORT, port->gpio, changed & ~next);
+        }
+        port->level ^= changed;
+        self->stats->performed++;
+    }
+}
+
+void DigitalOutputGroupGetStats(digital_output_group_t self, digital_output_stats_t * stats){
+    *stats = *self->stats;
 }
 digital_input_t DigitalInputCreate(uint8_t gpio, uint8_t bit,bool inverted){
-    digital_input_t self = malloc(sizeof(struct digital_input_s));
-    if (self !=NULL)
+    digital_input_t self = NULL;
+    if (inputs_used < DIGITAL_INPUTS_MAX)
     {
+        self = &inputs[inputs_used++];
         self ->gpio=gpio;
         self->bit=bit;
         self->inverted = inverted;
+        self->port = NULL;
 
         Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->gpio, self->bit, false);
 
@@ -102,6 +349,11 @@ digital_input_t DigitalInputCreate(uint8_t gpio, uint8_t bit,bool inverted){
 }
 
 bool DigitalInputGetIsActive(digital_input_t self){
+    if (self->port != NULL)
+    {
+        return (self->port->active & (1UL << self->bit)) != 0;
+    }
+
     bool state = Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, self->gpio, self->bit);
     if (self->inverted)
     { 
@@ -114,6 +366,28 @@ bool DigitalInputGetIsActive(digital_input_t self){
 digital_states_t DigitalInputWasChanged(digital_input_t self){
     digital_states_t result = DIGITAL_INPUT_NO_CHANGE;
 
+    if (self->port != NULL)
+    {
+        uint32_t mask = 1UL << self->bit;
+
+        /* Si hubo ambos flancos entre consultas se informan de a uno, en orden. Los flancos se alternan y el último
+         * deja la entrada en su estado actual, así que primero ocurrió el contrario a ese estado. */
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        uint32_t first = self->port->activated & self->port->deactivated & mask;
+        if ((self->port->activated & mask) && !(first & self->port->active))
+        {
+            result = DIGITAL_INPUT_WAS_ACTIVATED;
+            self->port->activated &= ~mask;
+        }else if (self->port->deactivated & mask)
+        {
+            result = DIGITAL_INPUT_WAS_DEACTIVATED;
+            self->port->deactivated &= ~mask;
+        }
+        __set_PRIMASK(primask);
+        return result;
+    }
+
     bool state = DigitalInputGetIsActive(self);
 
     if (state && !self->lastState)
@@ -129,14 +403,191 @@ digital_states_t DigitalInputWasChanged(digital_input_t self){
 }
 
 bool DigitalInputWasActivated(digital_input_t self){
+    if (self->port != NULL)
+    {
+        uint32_t mask = 1UL << self->bit;
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        bool result = (self->port->activated & mask) != 0;
+        self->port->activated &= ~mask;
+        __set_PRIMASK(primask);
+        return result;
+    }
     return DIGITAL_INPUT_WAS_ACTIVATED == DigitalInputWasChanged(self);
 }
 
 bool DigitalInputWasDeactivated(digital_input_t self){
+    if (self->port != NULL)
+    {
+        uint32_t mask = 1UL << self->bit;
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        bool result = (self->port->deactivated & mask) != 0;
+        self->port->deactivated &= ~mask;
+        __set_PRIMASK(primask);
+        return result;
+    }
     return DIGITAL_INPUT_WAS_DEACTIVATED == DigitalInputWasChanged(self);
 }
 
+digital_input_group_t DigitalInputGroupCreate(void){
+    digital_input_group_t self = NULL;
+    if (input_groups_used < DIGITAL_INPUT_GROUPS_MAX)
+    {
+        self = &input_groups[input_groups_used++];
+    }
+    return self;
+}
+
+digital_input_t DigitalInputGroupAdd(digital_input_group_t group, uint8_t gpio, uint8_t bit, bool inverted){
+    struct digital_port_s * port = NULL;
+    digital_input_t self = NULL;
+
+    for (uint8_t index = 0; index < group->ports; index++)
+    {
+        if (group->port[index].gpio == gpio)
+        {
+            port = &group->port[index];
+        }
+    }
+    if ((port == NULL) && (group->ports < DIGITAL_GROUP_MAX_PORTS))
+    {
+        port = &group->port[group->ports++];
+        port->gpio = gpio;
+    }
+
+    if ((port != NULL) && (inputs_used < DIGITAL_INPUTS_MAX))
+    {
+        self = &inputs[inputs_used++];
+        self->gpio = gpio;
+        self->bit = bit;
+        self->inverted = inverted;
+        self->port = port;
+
+        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, gpio, bit, false);
+
+        port->mask |= (1UL << bit);
+        if (inverted)
+        {
+            port->inverted |= (1UL << bit);
+        }
+        /* El estado inicial no genera flancos */
+        port->active = (Chip_GPIO_GetPortValue(LPC_GPIO_PORT, gpio) ^ port->inverted) & port->mask;
+    }
+    return self;
+}
+
+bool DigitalInputGroupScan(digital_input_group_t self){
+    struct digital_port_s * port;
+    uint32_t delta;
+    uint32_t changed;
+    uint32_t any = 0;
+
+    for (uint8_t index = 0; index < self->ports; index++)
+    {
+        port = &self->port[index];
+        /* Pines cuyo nivel leído difiere del estado filtrado */
+        delta = ((Chip_GPIO_GetPortValue(LPC_GPIO_PORT, port->gpio) ^ port->inverted) & port->mask) ^ port->active;
+
+        /* Incrementa el contador de los pines que difieren y pone en cero el del resto */
+        port->count1 = (port->count1 ^ port->count0) & delta;
+        port->count0 = ~port->count0 & delta;
+
+        /* Un contador que vuelve a cero sin dejar de diferir completó las lecturas necesarias */
+        changed = delta & ~(port->count0 | port->count1);
+        port->active ^= changed;
+        port->activated |= changed & port->active;
+        port->deactivated |= changed & ~port->active;
+        any |= changed;
+
+#if TRACE_ENABLED
+        for (uint32_t pins = changed; pins != 0; pins &= pins - 1) {
+            uint8_t bit = __builtin_ctz(pins);
+            TRACE(((port->active >> bit) & 1) ? TRACE_INPUT_ACTIVATED : TRACE_INPUT_DEACTIVATED,
+                  (port->gpio << 5) | bit);
+        }
+#endif
+    }
+    return any != 0;
+}
+
+bool DigitalInputGroupWasChanged(digital_input_group_t self){
+    uint32_t pending = 0;
+
+    for (uint8_t index = 0; index < self->ports; index++)
+    {
+        pending |= self->port[index].activated | self->port[index].deactivated;
+    }
+    return pending != 0;
+}
+
+void DigitalEventsInit(digital_timestamp_t timestamp, digital_notify_t notify){
+    memset(events, 0, sizeof(events));
+    events->timestamp = timestamp;
+    events->notify = notify;
+}
+
+int DigitalInputEnableEvents(digital_input_t self, uint8_t channel){
+    if ((channel >= DIGITAL_EVENTS_CHANNELS) || (events->channel[channel] != NULL))
+    {
+        return -1;
+    }
+    events->channel[channel] = self;
+
+    Chip_SCU_GPIOIntPinSel(channel, self->gpio, self->bit);
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, PININTCH(channel));
+    Chip_PININT_SetPinModeEdge(LPC_GPIO_PIN_INT, PININTCH(channel));
+    Chip_PININT_EnableIntHigh(LPC_GPIO_PIN_INT, PININTCH(channel));
+    Chip_PININT_EnableIntLow(LPC_GPIO_PIN_INT, PININTCH(channel));
+    NVIC_ClearPendingIRQ(PIN_INT0_IRQn + channel);
+    NVIC_EnableIRQ(PIN_INT0_IRQn + channel);
+    return 0;
+}
+
+bool DigitalEventsPending(void){
+    return events->tail != events->head;
+}
 
+bool DigitalEventGet(digital_event_t * event){
+    if (events->tail == events->head)
+    {
+        return false;
+    }
+    *event = events->queue[events->tail];
+    events->tail = (events->tail + 1) % DIGITAL_EVENTS_QUEUE_LENGTH;
+    return true;
+}
 
+void GPIO0_IRQHandler(void){
+    DigitalEventsHandler(0);
+}
+
+void GPIO1_IRQHandler(void){
+    DigitalEventsHandler(1);
+}
+
+void GPIO2_IRQHandler(void){
+    DigitalEventsHandler(2);
+}
+
+void GPIO3_IRQHandler(void){
+    DigitalEventsHandler(3);
+}
+
+void GPIO4_IRQHandler(void){
+    DigitalEventsHandler(4);
+}
+
+void GPIO5_IRQHandler(void){
+    DigitalEventsHandler(5);
+}
+
+void GPIO6_IRQHandler(void){
+    DigitalEventsHandler(6);
+}
+
+void GPIO7_IRQHandler(void){
+    DigitalEventsHandler(7);
+}
 
 /* === End of documentation ======================================================================================== */
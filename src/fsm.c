@@ -0,0 +1,107 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file fsm.c
+ ** @brief Código fuente de la máquina de estados dirigida por una tabla
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "fsm.h"
+#include "trace.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#ifndef FSM_MAX_INSTANCES
+#define FSM_MAX_INSTANCES 1 //!< Cantidad máxima de máquinas de estados, reservadas en memoria estática
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+/*! Estructura que representa una máquina de estados */
+struct fsm_s {
+    fsm_table_t table; //!< Definición de la máquina
+    void * context;    //!< Contexto que reciben las acciones
+    uint8_t state;     //!< Estado actual
+};
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Máquinas disponibles y cantidad ya creadas
+static struct fsm_s instances[FSM_MAX_INSTANCES];
+static uint16_t instances_used;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function implementation ============================================================================= */
+
+/* === Public function implementation ============================================================================== */
+
+fsm_t FsmCreate(fsm_table_t table, uint8_t initial, void * context) {
+    fsm_t self;
+
+    if ((table == NULL) || (initial == FSM_STAY) || (initial >= table->states_count) ||
+        (instances_used >= FSM_MAX_INSTANCES)) {
+        return NULL;
+    }
+    self = &instances[instances_used++];
+    self->table = table;
+    self->context = context;
+    self->state = initial;
+    if (table->states[initial].entry != NULL) {
+        table->states[initial].entry(context);
+    }
+    return self;
+}
+
+void FsmDispatch(fsm_t self, uint8_t event) {
+    const fsm_transition_t * transition;
+    uint8_t next;
+
+    if (event >= self->table->events_count) {
+        return;
+    }
+    transition = &self->table->transitions[self->state * self->table->events_count + event];
+    next = transition->next;
+    if (transition->action != NULL) {
+        next = transition->action(self->context, next);
+    }
+    if ((next == FSM_STAY) || (next >= self->table->states_count)) {
+        return;
+    }
+
+    /* Una transición al mismo estado sale y vuelve a entrar, para reiniciarlo */
+    if (self->table->states[self->state].exit != NULL) {
+        self->table->states[self->state].exit(self->context);
+    }
+    self->state = next;
+    TRACE(TRACE_STATE, next);
+    if (self->table->states[next].entry != NULL) {
+        self->table->states[next].entry(self->context);
+    }
+}
+
+uint8_t FsmGetState(fsm_t self) {
+    return self->state;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,189 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file gesture.c
+ ** @brief Código fuente del módulo que reconoce gestos sobre una tecla
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "gesture.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#ifndef GESTURES_MAX
+#define GESTURES_MAX 4 //!< Cantidad máxima de reconocedores de gestos, reservados en memoria estática
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+/*! Estructura que representa el reconocedor de gestos de una tecla */
+struct gesture_s {
+    digital_input_t input;   //!< Entrada digital de la tecla
+    gesture_config_t config; //!< Configuración de los gestos
+    bool pressed;            //!< Estado de la tecla en el avance anterior
+    bool consumed;           //!< La presión actual ya generó una presión larga o repeticiones
+    bool ignored;            //!< La presión actual empezó antes de crear el reconocedor
+    bool clicked;            //!< Hay un clic esperando un posible segundo clic
+    uint32_t held;           //!< Tiempo que lleva presionada la tecla (ms)
+    uint16_t released;       //!< Tiempo que lleva suelta la tecla después de un clic pendiente (ms)
+    uint32_t next_repeat;    //!< Tiempo de presión en el que corresponde la próxima repetición (ms)
+    uint16_t period;         //!< Intervalo actual entre repeticiones (ms)
+    struct {
+        gesture_event_t events[GESTURE_QUEUE_LENGTH]; //!< Eventos pendientes
+        volatile uint8_t head;                        //!< Posición donde se guarda el próximo evento
+        volatile uint8_t tail;                        //!< Posición del próximo evento a consultar
+    } queue[1];              //!< Cola de eventos entre la interrupción y el programa principal
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Guarda un evento en la cola, si la cola está llena el evento se descarta
+ *
+ * @param self Puntero al reconocedor
+ * @param event Evento a guardar
+ */
+static void GesturePush(gesture_t self, gesture_event_t event);
+
+/**
+ * @brief Procesa el avance del reconocedor mientras la tecla está presionada
+ *
+ * @param self Puntero al reconocedor
+ * @param elapsed_ms Tiempo transcurrido desde el avance anterior (ms)
+ */
+static void GestureHeld(gesture_t self, uint16_t elapsed_ms);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Reconocedores disponibles y cantidad ya creados
+static struct gesture_s gestures[GESTURES_MAX];
+static uint16_t gestures_used;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void GesturePush(gesture_t self, gesture_event_t event) {
+    uint8_t head = (self->queue->head + 1) % GESTURE_QUEUE_LENGTH;
+
+    if (head != self->queue->tail) {
+        self->queue->events[self->queue->head] = event;
+        self->queue->head = head;
+    }
+}
+
+static void GestureHeld(gesture_t self, uint16_t elapsed_ms) {
+    gesture_config_t config = self->config;
+    uint32_t previous = self->held;
+    bool long_press;
+    bool repeat;
+
+    /* Las cuentas de 32 bits no se desbordan en una presión real. Si la tecla queda trabada la cuenta se detiene y
+     * deja de repetir en lugar de volver a empezar y repetir en cada avance. */
+    self->held = (previous < UINT32_MAX - elapsed_ms) ? previous + elapsed_ms : UINT32_MAX;
+    long_press = config->long_press_ms && (previous < config->long_press_ms) && (self->held >= config->long_press_ms);
+    repeat = config->repeat_delay_ms && (self->held != previous) && (self->held >= self->next_repeat);
+
+    if ((long_press || repeat) && self->clicked) {
+        /* Un clic pendiente seguido de una presión larga no forma un doble clic */
+        self->clicked = false;
+        GesturePush(self, GESTURE_CLICK);
+    }
+    if (long_press) {
+        self->consumed = true;
+        GesturePush(self, GESTURE_LONG_PRESS);
+    }
+    if (repeat) {
+        self->consumed = true;
+        GesturePush(self, GESTURE_REPEAT);
+        self->next_repeat = (self->next_repeat < UINT32_MAX - self->period) ? self->next_repeat + self->period
+                                                                             : UINT32_MAX;
+        if (self->period > config->repeat_min_ms + config->repeat_step_ms) {
+            self->period -= config->repeat_step_ms;
+        } else {
+            self->period = config->repeat_min_ms;
+        }
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+gesture_t GestureCreate(digital_input_t input, gesture_config_t config) {
+    gesture_t self = NULL;
+    if (gestures_used < GESTURES_MAX) {
+        self = &gestures[gestures_used++];
+        self->input = input;
+        self->config = config;
+        /* Una tecla presionada al arrancar no genera gestos hasta soltarse */
+        self->pressed = DigitalInputGetIsActive(input);
+        self->ignored = self->pressed;
+    }
+    return self;
+}
+
+void GestureTick(gesture_t self, uint16_t elapsed_ms) {
+    gesture_config_t config = self->config;
+    bool pressed = DigitalInputGetIsActive(self->input);
+
+    if (self->ignored) {
+        self->ignored = pressed;
+    } else if (pressed && !self->pressed) {
+        self->held = 0;
+        self->consumed = false;
+        self->next_repeat = config->repeat_delay_ms;
+        self->period = config->repeat_period_ms;
+    } else if (pressed) {
+        GestureHeld(self, elapsed_ms);
+    } else if (self->pressed && !self->consumed) {
+        if (self->clicked) {
+            self->clicked = false;
+            GesturePush(self, GESTURE_DOUBLE_CLICK);
+        } else if (config->double_click_ms) {
+            self->clicked = true;
+            self->released = 0;
+        } else {
+            GesturePush(self, GESTURE_CLICK);
+        }
+    } else if (self->clicked) {
+        self->released += elapsed_ms;
+        if (self->released >= config->double_click_ms) {
+            self->clicked = false;
+            GesturePush(self, GESTURE_CLICK);
+        }
+    }
+    self->pressed = pressed;
+}
+
+gesture_event_t GestureGetEvent(gesture_t self) {
+    gesture_event_t event = GESTURE_NONE;
+
+    if (self->queue->tail != self->queue->head) {
+        event = self->queue->events[self->queue->tail];
+        self->queue->tail = (self->queue->tail + 1) % GESTURE_QUEUE_LENGTH;
+    }
+    return event;
+}
+
+bool GestureHasEvent(gesture_t self) {
+    return self->queue->tail != self->queue->head;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,168 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file latency.c
+ ** @brief Código fuente del módulo que mide la latencia de las teclas
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "latency.h"
+#include "chip.h"
+#include <stdbool.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define US_PER_SECOND 1000000UL //!< Microsegundos en un segundo
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Convierte ciclos del núcleo en microsegundos
+ *
+ * @param cycles Ciclos transcurridos
+ * @return uint32_t Microsegundos transcurridos
+ */
+static uint32_t LatencyMicroseconds(uint32_t cycles);
+
+/**
+ * @brief Suma la medición en curso, que ya marcó todas las etapas, a los resultados
+ */
+static void LatencyComplete(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Estado de la medición
+static struct {
+    bool active;                      //!< Hay una medición en curso
+    uint8_t stage;                    //!< Última etapa marcada de la medición en curso
+    uint32_t started;                 //!< Ciclo del flanco que empezó la medición en curso
+    uint32_t elapsed[LATENCY_STAGES]; //!< Microsegundos hasta cada etapa de la medición en curso
+    uint64_t total[LATENCY_STAGES];   //!< Suma de los tiempos de las mediciones completas, para el promedio
+    latency_stats_t stats;            //!< Resultados, sin los promedios que se calculan al consultarlos
+} latency[1];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function implementation ============================================================================= */
+
+static uint32_t LatencyMicroseconds(uint32_t cycles) {
+    uint32_t per_us = SystemCoreClock / US_PER_SECOND;
+
+    return (per_us != 0) ? cycles / per_us : cycles;
+}
+
+static void LatencyComplete(void) {
+    uint32_t shown = latency->elapsed[LATENCY_SHOWN];
+    uint32_t bucket = shown / LATENCY_BUCKET_US;
+
+    for (uint8_t stage = LATENCY_HANDLED; stage < LATENCY_STAGES; stage++) {
+        latency->total[stage] += latency->elapsed[stage];
+        if (latency->elapsed[stage] > latency->stats.max[stage]) {
+            latency->stats.max[stage] = latency->elapsed[stage];
+        }
+    }
+    latency->stats.histogram[(bucket < LATENCY_BUCKETS) ? bucket : LATENCY_BUCKETS - 1]++;
+    latency->stats.count++;
+    latency->active = false;
+}
+
+/* === Public function implementation ============================================================================== */
+
+void LatencyInit(void) {
+#ifdef __arm__
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    SystemCoreClockUpdate();
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    memset(latency, 0, sizeof(latency));
+    __set_PRIMASK(primask);
+}
+
+uint32_t LatencyNow(void) {
+#ifdef __arm__
+    return DWT->CYCCNT;
+#else
+    return HostCoreCycles();
+#endif
+}
+
+void LatencyEdge(uint32_t timestamp) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (latency->active && (LatencyMicroseconds(LatencyNow() - latency->started) > LATENCY_TIMEOUT_US)) {
+        latency->stats.discarded++;
+        latency->active = false;
+    }
+    if (!latency->active) {
+        latency->active = true;
+        latency->stage = LATENCY_EDGE;
+        latency->started = timestamp;
+    }
+    __set_PRIMASK(primask);
+}
+
+void LatencyMark(latency_stage_t stage) {
+    uint32_t elapsed;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (latency->active && (stage == (latency_stage_t)(latency->stage + 1))) {
+        elapsed = LatencyMicroseconds(LatencyNow() - latency->started);
+        if (elapsed > LATENCY_TIMEOUT_US) {
+            latency->stats.discarded++;
+            latency->active = false;
+        } else {
+            latency->elapsed[stage] = elapsed;
+            latency->stage = stage;
+            if (stage == LATENCY_SHOWN) {
+                LatencyComplete();
+            }
+        }
+    }
+    __set_PRIMASK(primask);
+}
+
+void LatencySettle(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (latency->active && (latency->stage == LATENCY_HANDLED)) {
+        latency->stats.discarded++;
+        latency->active = false;
+    }
+    __set_PRIMASK(primask);
+}
+
+void LatencyGet(latency_stats_t * stats) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *stats = latency->stats;
+    for (uint8_t stage = LATENCY_HANDLED; stage < LATENCY_STAGES; stage++) {
+        stats->mean[stage] = (stats->count != 0) ? (uint32_t)(latency->total[stage] / stats->count) : 0;
+    }
+    __set_PRIMASK(primask);
+}
+
+/* === End of documentation ======================================================================================== */
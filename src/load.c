@@ -0,0 +1,149 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file load.c
+ ** @brief Código fuente del módulo que mide la carga del procesador
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "load.h"
+#include "chip.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Lee el contador de ciclos del núcleo
+ *
+ * @return uint32_t Ciclos desde un origen arbitrario, solo sirve para restar instantes separados menos de 21 s
+ */
+static uint32_t LoadNow(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Estado de la medición
+static struct {
+    uint16_t ticks_per_second;             //!< Llamadas a LoadTick() en un segundo
+    uint16_t ticks;                        //!< Ticks contados en el segundo actual
+    uint32_t started;                      //!< Ciclo en que empezó el segundo actual
+    uint32_t idle;                         //!< Ciclos dormidos en el segundo actual
+    uint16_t history[LOAD_MINUTE_SECONDS]; //!< Carga de cada uno de los últimos segundos
+    uint32_t history_total;                //!< Suma de las cargas guardadas en history
+    load_stats_t stats;                    //!< Últimas cargas calculadas
+} load[1];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function implementation ============================================================================= */
+
+static uint32_t LoadNow(void) {
+#ifdef __arm__
+    return DWT->CYCCNT;
+#else
+    return HostCoreCycles();
+#endif
+}
+
+/* === Public function implementation ============================================================================== */
+
+void LoadInit(uint16_t ticks_per_second) {
+#ifdef __arm__
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    memset(load, 0, sizeof(load));
+    load->ticks_per_second = ticks_per_second;
+    load->started = LoadNow();
+    __set_PRIMASK(primask);
+}
+
+void LoadSleep(void) {
+    uint32_t primask = __get_PRIMASK();
+    uint32_t slept;
+
+    /* Con las interrupciones bloqueadas __WFI() igual despierta, pero el manejador espera hasta desbloquearlas y su
+     * tiempo no se cuenta como dormido. Al terminar se restaura el bloqueo previo: el despachador lo llama con las
+     * interrupciones ya bloqueadas y las desbloquea recién después de decidir que no hay tareas listas. */
+    __disable_irq();
+    slept = LoadNow();
+    __WFI();
+    load->idle += LoadNow() - slept;
+    __set_PRIMASK(primask);
+}
+
+void LoadTick(void) {
+    uint32_t now, elapsed;
+    uint16_t second = 0;
+    uint8_t slot;
+
+    load->ticks++;
+    if (load->ticks < load->ticks_per_second) {
+        return;
+    }
+    now = LoadNow();
+    elapsed = now - load->started;
+    if (load->idle < elapsed) {
+        second = (uint16_t)(LOAD_FULL - ((uint64_t)load->idle * LOAD_FULL) / elapsed);
+    }
+    load->ticks = 0;
+    load->idle = 0;
+    load->started = now;
+
+    slot = load->stats.seconds % LOAD_MINUTE_SECONDS;
+    load->history_total = load->history_total - load->history[slot] + second;
+    load->history[slot] = second;
+    load->stats.seconds++;
+    load->stats.second = second;
+    load->stats.minute = (uint16_t)(load->history_total / ((load->stats.seconds < LOAD_MINUTE_SECONDS)
+                                                               ? load->stats.seconds
+                                                               : LOAD_MINUTE_SECONDS));
+    if (second > load->stats.peak) {
+        load->stats.peak = second;
+    }
+}
+
+void LoadGet(load_stats_t * stats) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *stats = load->stats;
+    __set_PRIMASK(primask);
+}
+
+void LoadResetPeak(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    load->stats.peak = 0;
+    __set_PRIMASK(primask);
+}
+
+bool LoadWithinBudget(uint16_t budget) {
+    load_stats_t stats;
+
+    LoadGet(&stats);
+    return stats.peak <= budget;
+}
+
+/* === End of documentation ======================================================================================== */
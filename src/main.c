@@ -41,414 +41,184 @@
 /* === Headers files inclusions =============================================================== */
 
 #include "bsp.h"
-#include <stdint.h>
 #include <stdbool.h>
-#include "clock.h"
+#include <stddef.h>
+#include "app.h"
+#include "latency.h"
+#include "load.h"
+#include "profile.h"
+#include "scheduler.h"
+#include "trace.h"
 
 /* === Macros definitions ====================================================================== */
 
-#define CLOCK_TICKS_PER_SECOND 1000  ///< Cantidad de ticks por segundo
-#define BUTTON_SET_DELAY 3000        ///< Tiempo de presión para entrar en modo ajuste (ms)
-#define DISPLAY_FLASH_FREQUENCY 200  ///< Frecuencia de parpadeo de dígitos
-#define INACTIVITY_TIMEOUT_MS 30000  ///< Tiempo máximo de inactividad (ms)
-
 /* === Private data type declarations ========================================================== */
 
-/**
- * @brief Estados de funcionamiento del reloj
- *
- */
-typedef enum {
-    UNCONFIGURED,     //!< Hora no configurada
-    SHOW_TIME,        //!< Visualización de hora actual
-    SET_TIME_MINUTE,  //!< Configuración de los minutos 
-    SET_TIME_HOUR,    //!< Configuración de las horas
-    SET_ALARM_MINUTE, //!< Configuración de los minutos de la alarma
-    SET_ALARM_HOUR,   //!< Configuración de las horas de la alarma
-} states_clock;
-
-/**
- * @brief Estados de boton
- * 
- */
-typedef struct {
-    bool is_pressed;            //!< Boton presionado
-    bool was_processed;         //!< Ya fue presionado el boton
-    uint32_t press_start_time;  //!< Empieza a presionar el boton
-} button_status_t;
+//! Tareas del programa principal, en el orden de la tabla
+enum {
+    TASK_KEYS,   //!< Teclas y tiempos de espera de los ajustes
+    TASK_ALARM,  //!< Secuencias de la alarma
+    TASK_RENDER, //!< Cuadro de la pantalla
+    TASKS_COUNT, //!< Cantidad de tareas
+};
 
 /* === Private variable declarations =========================================================== */
 
-static board_t board;
-static clock_t clock;
-static states_clock current_mode;
-static uint8_t digits[4];
-static uint32_t inactivity_timer = 0;
+static app_t app;
 
-/* botones largos */
-static button_status_t btn_set_time_status = {0};
-static button_status_t btn_set_alarm_status = {0};
+static scheduler_t scheduler;
 
 /* === Private function declarations =========================================================== */
 
 /**
- * @brief Alarma sonando
- * 
- * @param clock invocacion al reloj
+ * @brief Atiende el temporizador de barrido de la placa
  */
-static void AlarmaRinging(clock_t clock);
+static void ScanHandler(void);
 
 /**
- * @brief Cambia el estado del reloj
- * 
- * @param new_mode Nuevo estado a trabajar
+ * @brief Atiende el temporizador de tiempo de la placa
  */
-static void clock_switch_mode(states_clock new_mode);
+static void TickHandler(void);
 
 /**
- * @brief Incrementa el valor de un numero en BCD respetando un limite maximo
- * 
- * @param units Unidades
- * @param tens Decenas
- * @param max_units Máximo de unidades
- * @param max_tens Máximo de decenas
+ * @brief Activa la tarea de las teclas con cada flanco físico, se llama desde la interrupción de la entrada
  */
-static void clock_increment_bcd(uint8_t *units, uint8_t *tens, uint8_t max_units, uint8_t max_tens);
+static void KeysEdge(void);
 
 /**
- * @brief Decrementa el valor de un numero en BCD respetando un limite maximo
- * 
- * @param units Unidades
- * @param tens Decenas
- * @param max_units Máximo de unidades
- * @param max_tens Máximo de decenas
+ * @brief Activa la tarea que atiende el trabajo pedido por la aplicación
+ *
+ * @param context Planificador de las tareas
+ * @param work Trabajo pedido
  */
-static void clock_decrement_bcd(uint8_t *units, uint8_t *tens, uint8_t max_units, uint8_t max_tens);
+static void WorkRequested(void * context, app_work_t work);
 
 /**
- * @brief Convierte un tiempo de un arreglo BCD de 4 dígitos a clock_time_t
- * 
- * @param time Puntero a la estructura de tiempo  clock_time_t
- * @param bcd Puntero a un arreglo de 4 elementos donde se almacena el tiempo en formato [decena_hora, unidad_hora,
- * decena_minuto, unidad_minuto]
+ * @brief Tarea que atiende las teclas
  */
-static void clock_convert_time_to_bcd(clock_time_t *time, uint8_t *bcd);
+static void KeysTask(void * context);
 
 /**
- * @brief Convierte un tiempo en formato clock_time_t a un arreglo BCD de 4 dígitos.
- * 
- * @param time Puntero a la estructura de tiempo  clock_time_t
- * @param bcd Puntero a un arreglo de 4 elementos donde se almacena el tiempo en formato [decena_hora, unidad_hora,
- * decena_minuto, unidad_minuto]
+ * @brief Tarea que atiende las secuencias de la alarma
  */
-static void clock_convert_bcd_to_time(clock_time_t *time, uint8_t *bcd);
+static void AlarmTask(void * context);
 
 /**
- * @brief Controla el tiempo de boton presionado
- * 
- * @param button boton presionado
- * @param status estado del boton
- * @param delay tiempo presionado
- * @return true presionado tiempo necesario
- * @return false no presionado el tiempo necesario
+ * @brief Tarea que publica el cuadro de la pantalla
  */
-static bool btn_check_long_press(digital_input_t button, button_status_t *status, uint32_t delay_ms);
+static void RenderTask(void * context);
 
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
 
+/* Períodos en ticks del temporizador de tiempo. Las teclas y el cuadro no tienen período: los activan los flancos
+ * físicos y los pedidos de la aplicación, y deben atenderse en el tick en que llegan. Las secuencias de la alarma solo
+ * se detienen, para eso alcanza con revisarlas cada 50 ms. */
+static scheduler_task_t tasks[TASKS_COUNT] = {
+    [TASK_KEYS] = {.function = KeysTask, .priority = 0, .deadline = 1},
+    [TASK_ALARM] = {.function = AlarmTask, .priority = 1, .period = APP_TICKS_PER_SECOND / 20},
+    [TASK_RENDER] = {.function = RenderTask, .priority = 2, .deadline = 1},
+};
+
 /* === Private function implementation ========================================================= */
 
-static void AlarmaRinging(clock_t clock){
-    DigitalOutputActivate(board->led_red);
+static void ScanHandler(void) {
+    TRACE(TRACE_ISR_ENTER, TRACE_ISR_SCAN);
+    PROFILE_BEGIN(scan_isr);
+    AppScan(app);
+    PROFILE_END(scan_isr);
+    TRACE(TRACE_ISR_EXIT, TRACE_ISR_SCAN);
 }
 
-static bool btn_check_long_press(digital_input_t button, button_status_t *status, uint32_t delay_ms) {
-    const uint32_t debounce = 50;
-    if (DigitalInputGetIsActive(button)) {
-        if (!status->is_pressed) {
-            status->is_pressed = true;
-            status->press_start_time = inactivity_timer;
-            status->was_processed = false;
-        } else if (!status->was_processed) {
-            uint32_t held = inactivity_timer - status->press_start_time;
-            if (held >= delay_ms + debounce) {
-                status->was_processed = true;
-                return true;
-            }
-        }
-    } else {
-        status->is_pressed = false;
-        status->was_processed = false;
-        status->press_start_time = 0;
-    }
-    return false;
+static void TickHandler(void) {
+    TRACE(TRACE_ISR_ENTER, TRACE_ISR_TICK);
+    PROFILE_BEGIN(tick_isr);
+    LoadTick();
+    AppTick(app);
+    SchedulerTick(scheduler);
+    PROFILE_END(tick_isr);
+    TRACE(TRACE_ISR_EXIT, TRACE_ISR_TICK);
 }
 
-static void clock_switch_mode(states_clock new_mode) {
-    current_mode = new_mode;
-    inactivity_timer = 0;
-    switch (current_mode) {
-    case UNCONFIGURED:
-        DisplayFlashDigits(board->screen, 0, 3, DISPLAY_FLASH_FREQUENCY);
-        ScreenToggleDot(board->screen, 1);
-        break;
-    case SHOW_TIME:
-        DisplayFlashDigits(board->screen, 0, 0, 0);
-        ScreenToggleDot(board->screen, 1);
-        break;
-    case SET_TIME_MINUTE:
-        DisplayFlashDigits(board->screen, 2, 3, DISPLAY_FLASH_FREQUENCY);
-        break;
-    case SET_TIME_HOUR:
-        DisplayFlashDigits(board->screen, 0, 1, DISPLAY_FLASH_FREQUENCY);
-        break;
-    case SET_ALARM_MINUTE:
-        DisplayFlashDigits(board->screen, 2, 3, DISPLAY_FLASH_FREQUENCY);
-        ScreenToggleDot(board->screen, 0);
-        ScreenToggleDot(board->screen, 1);
-        ScreenToggleDot(board->screen, 2);
-        ScreenToggleDot(board->screen, 3);
-        break;
-    case SET_ALARM_HOUR:
-        DisplayFlashDigits(board->screen, 0, 1, DISPLAY_FLASH_FREQUENCY);
-        ScreenToggleDot(board->screen, 0);
-        ScreenToggleDot(board->screen, 1);
-        ScreenToggleDot(board->screen, 2);
-        ScreenToggleDot(board->screen, 3);
-        break;
-    }
+static void KeysEdge(void) {
+    SchedulerSignal(scheduler, TASK_KEYS);
 }
 
-static void clock_increment_bcd(uint8_t *units, uint8_t *tens, uint8_t max_units, uint8_t max_tens) {
-    (*units)++;
-    if (*units > 9) {
-        *units = 0;
-        (*tens)++;
-        if (*tens > max_tens) {
-            *tens = 0;
-            *units = 0;
-        }
-    }
+static void WorkRequested(void * context, app_work_t work) {
+    static const uint8_t WORK_TASK[] = {
+        [APP_WORK_KEYS] = TASK_KEYS,
+        [APP_WORK_RENDER] = TASK_RENDER,
+    };
 
-    if (*tens == max_tens && *units > max_units)
-    {
-        *tens = 0;
-        *units = 0;
-    }
+    SchedulerSignal(context, WORK_TASK[work]);
 }
 
-static void clock_decrement_bcd(uint8_t *units, uint8_t *tens, uint8_t max_units, uint8_t max_tens) {
-    if (*units > 0) {
-        (*units)--;
-    } else {
-        if (*tens > 0) {
-            (*tens)--;
-            *units = 9;
-        } else {
-            *tens = max_tens;
-            *units = max_units;
+static void KeysTask(void * context) {
+    digital_event_t event;
+
+    /* Los flancos físicos llegan antes que los filtrados, cada pulsación empieza una medición de latencia. La cola se
+     * vacía siempre, aunque no se mida, para que no se pierdan los avisos de los flancos siguientes. */
+    while (DigitalEventGet(&event)) {
+#if LATENCY_ENABLED
+        if (event.edge == DIGITAL_INPUT_WAS_ACTIVATED) {
+            LatencyEdge(event.timestamp);
         }
+#else
+        (void)event;
+#endif
     }
+    AppHandleKeys(context);
 }
 
-static void clock_convert_time_to_bcd(clock_time_t *time, uint8_t digits[]) {
-     if (time && digits) {
-        digits[0] = time->bcd[5]; // Hora de decenas
-        digits[1] = time->bcd[4]; // Hora de unidades
-        digits[2] = time->bcd[3]; // Minuto de decenas
-        digits[3] = time->bcd[2]; // Minuto de unidades
-    }
- }
-
-static void clock_convert_bcd_to_time(clock_time_t *time, uint8_t digits[]) {
-     if (time && digits) {
-        time->bcd[5] = digits[0]; // Hora de decenas
-        time->bcd[4] = digits[1]; // Hora de unidades
-        time->bcd[3] = digits[2]; // Minuto de decenas
-        time->bcd[2] = digits[3]; // Minuto de unidades
-        time->bcd[1] = 0;
-        time->bcd[0] = 0;
-    }
+static void AlarmTask(void * context) {
+    AppHandleAlarm(context);
+}
+
+static void RenderTask(void * context) {
+    AppRender(context);
 }
 
 /* === Public function implementation ========================================================= */
 
 int main(void) {
+    board_t board;
 
-    clock_time_t current_time_data, alarm_time_data; 
-
-    clock = ClockCreate(CLOCK_TICKS_PER_SECOND, AlarmaRinging);
+    PROFILE_INIT();
+    TRACE_INIT();
+    LoadInit(APP_TICKS_PER_SECOND);
+    LATENCY_INIT();
     board = BoardCreate();
-    SysTickInit(CLOCK_TICKS_PER_SECOND);
-    clock_switch_mode(UNCONFIGURED);
-
-    while (true) {
-        /* PRESION LARGA F1: entrar a set time minute */
-        if (btn_check_long_press(board->set_time, &btn_set_time_status, BUTTON_SET_DELAY)) {
-            if (ClockGetTime(clock, &current_time_data)) {
-                clock_convert_time_to_bcd(&current_time_data, digits);
-            } else {
-                // si no está configurado, arrancar de 00:00
-                digits[0] = digits[1] = digits[2] = digits[3] = 0;
-            }
-            ScreenWriteBCD(board->screen, digits, sizeof(digits));
-            clock_switch_mode(SET_TIME_MINUTE);
-        }
-
-        /* PRESION LARGA F2: entrar a set alarm minute */
-        if (btn_check_long_press(board->set_alarm, &btn_set_alarm_status, BUTTON_SET_DELAY)) {
-            if (ClockGetAlarm(clock, &alarm_time_data)) {
-                clock_convert_time_to_bcd(&alarm_time_data, digits);
-            } else {
-                digits[0] = digits[1] = digits[2] = digits[3] = 0;
-            }
-            ScreenWriteBCD(board->screen, digits, sizeof(digits));
-            clock_switch_mode(SET_ALARM_MINUTE);
-        } 
-
-       if (DigitalInputWasDeactivated(board->accept)) {
-            if (current_mode == SHOW_TIME) {
-                if (ClockSetAlarm(clock, &alarm_time_data))
-                {
-                    ClockIsAlarmEnabled(clock);
-                }
-
-                if (ClockIsAlarmActive(clock)) {
-                    ClockSnoozeAlarm(clock);
-                }
-            } else if (current_mode == SET_TIME_MINUTE) {
-                clock_switch_mode(SET_TIME_HOUR);
-            } else if (current_mode == SET_TIME_HOUR) {
-                clock_convert_bcd_to_time(&current_time_data, digits);
-                ClockSetTime(clock, &current_time_data);
-                clock_switch_mode(SHOW_TIME);
-            } else if (current_mode == SET_ALARM_MINUTE) {
-                clock_switch_mode(SET_ALARM_HOUR);
-            } else if (current_mode == SET_ALARM_HOUR) {
-                clock_convert_bcd_to_time(&alarm_time_data, digits);
-                ClockSetAlarm(clock, &alarm_time_data);
-                clock_switch_mode(SHOW_TIME);
-            }
-        }
-
-        if (DigitalInputWasDeactivated(board->cancel)) {
-            if (current_mode == SHOW_TIME) {
-                if (ClockIsAlarmActive(clock)) {
-                    ClockPostponeAlarmToNextDay(clock);
-                    ScreenSetDot(board->screen, 3, true);
-                }else if (ClockIsAlarmEnabled(clock)) {
-                    ClockDisableAlarm(clock);
-                }
-            } else if (current_mode == SET_TIME_MINUTE || current_mode == SET_TIME_HOUR) {
-                if (ClockGetTime(clock, &current_time_data)) {
-                    clock_switch_mode(SHOW_TIME);
-                } else {
-                    clock_switch_mode(UNCONFIGURED);
-                }
-            } else if (current_mode == SET_ALARM_MINUTE || current_mode == SET_ALARM_HOUR) {
-                clock_switch_mode(SHOW_TIME);
-            }
-        }
-
-        if (DigitalInputWasDeactivated(board->decrement)) {
-            inactivity_timer = 0;
-            if (current_mode == SET_TIME_MINUTE || current_mode == SET_ALARM_MINUTE) {
-                clock_decrement_bcd(&digits[3], &digits[2], 9, 5);
-            } else if (current_mode == SET_TIME_HOUR || current_mode == SET_ALARM_HOUR) {
-                clock_decrement_bcd(&digits[1], &digits[0], 3, 2);
-            }
-
-            ScreenWriteBCD(board->screen, digits, sizeof(digits));
-
-            if (current_mode == SET_ALARM_MINUTE || current_mode == SET_ALARM_HOUR) {
-                ScreenToggleDot(board->screen, 0);
-                ScreenToggleDot(board->screen, 1);
-                ScreenToggleDot(board->screen, 2);
-                ScreenToggleDot(board->screen, 3);
-            }
-        }
-
-        if (DigitalInputWasDeactivated(board->increment)) {
-            inactivity_timer = 0;
-            if (current_mode == SET_TIME_MINUTE || current_mode == SET_ALARM_MINUTE) {
-                clock_increment_bcd(&digits[3], &digits[2], 9, 5);
-            } else if (current_mode == SET_TIME_HOUR || current_mode == SET_ALARM_HOUR) {
-                clock_increment_bcd(&digits[1], &digits[0], 3, 2);
-            }
-
-            ScreenWriteBCD(board->screen, digits, sizeof(digits));
-
-            if ( current_mode == SET_ALARM_MINUTE || current_mode == SET_ALARM_HOUR) {
-                ScreenToggleDot(board->screen, 0);
-                ScreenToggleDot(board->screen, 1);
-                ScreenToggleDot(board->screen, 2);
-                ScreenToggleDot(board->screen, 3);
-            }
-        }
-
-        /* TIEMPO DE INACTIVIDAD */
-        if ((current_mode == SET_TIME_MINUTE || current_mode == SET_TIME_HOUR ||
-             current_mode == SET_ALARM_MINUTE || current_mode == SET_ALARM_HOUR) &&
-            inactivity_timer >= INACTIVITY_TIMEOUT_MS) {
-            if (current_mode == SET_TIME_MINUTE || current_mode == SET_TIME_HOUR) {
-                if (ClockGetTime(clock, &current_time_data)) {
-                    clock_switch_mode(SHOW_TIME);
-                } else {
-                    clock_switch_mode(UNCONFIGURED);
-                }
-            } else {
-                clock_switch_mode(SHOW_TIME);
-            }
-        }
-
-        for (volatile int delay_loop = 0; delay_loop < 25000; delay_loop++) {
-            __asm("NOP");
-        }
+    app = AppCreate(board);
+    for (int index = 0; index < TASKS_COUNT; index++) {
+        tasks[index].context = app;
     }
- }
-
- void SysTick_Handler(void) {
-    static uint16_t flash_counter = 0;
-    clock_time_t time;
-
-    ScreenRefresh(board->screen);
-    ClockNewTick(clock);
-
-    inactivity_timer++;
-
-    if (current_mode == SHOW_TIME) {
-        flash_counter = (flash_counter + 1) % 1000;
-
-        if (ClockGetTime(clock, &time)) {
-            clock_convert_time_to_bcd(&time, digits);
-            ScreenWriteBCD(board->screen, digits, sizeof(digits));
-        }
-
-        if (flash_counter > 500) {
-            ScreenToggleDot(board->screen, 1);
-        }
-
-        if (ClockIsAlarmEnabled(clock)) {
-            ScreenSetDot(board->screen, 3, true);
-        } else {
-            ScreenSetDot(board->screen, 3, false);
-        }
-
-        if (ClockIsAlarmActive(clock)) {
-            ScreenSetDot(board->screen, 0, true);
-            DigitalOutputActivate(board->led_red);
-        } else {
-            ScreenSetDot(board->screen, 0, false);
-            DigitalOutputDeactivate(board->led_red);
-        }
-    }else if (current_mode == UNCONFIGURED){
-        digits[0] = digits[1] = digits[2] = digits[3] = 0;
-        ScreenWriteBCD(board->screen, digits, sizeof(digits));
-        ScreenSetDot(board->screen, 1, true);
+    scheduler = SchedulerCreate(tasks, TASKS_COUNT, LoadSleep);
+    AppSetNotify(app, WorkRequested, scheduler);
+
+    /* Cada flanco físico de una tecla activa la tarea de las teclas sin esperar a la próxima lectura filtrada */
+#if LATENCY_ENABLED
+    DigitalEventsInit(LatencyNow, KeysEdge);
+#else
+    DigitalEventsInit(NULL, KeysEdge);
+#endif
+    DigitalInputEnableEvents(board->set_time, 0);
+    DigitalInputEnableEvents(board->set_alarm, 1);
+    DigitalInputEnableEvents(board->decrement, 2);
+    DigitalInputEnableEvents(board->increment, 3);
+    DigitalInputEnableEvents(board->accept, 4);
+    DigitalInputEnableEvents(board->cancel, 5);
+    BoardScanTimerStart(ScanHandler);
+    BoardTickTimerStart(APP_TICKS_PER_SECOND, TickHandler);
+
+    /* Todo el trabajo nuevo lo generan las interrupciones: los flancos de las teclas y el temporizador de tiempo, que
+     * filtra las teclas, avanza los gestos y activa las tareas. Sin tareas activas se duerme hasta la próxima en lugar
+     * de esperar, y el tiempo dormido da la carga del procesador. */
+    while (true) {
+        SchedulerDispatch(scheduler);
     }
 }
+
 /* === End of documentation ==================================================================== */
 
 /** @} End of module definition for doxygen */
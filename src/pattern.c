@@ -0,0 +1,188 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file pattern.c
+ ** @brief Código fuente del módulo que reproduce secuencias de encendido y apagado sobre una salida digital
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "pattern.h"
+#include "chip.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define ON   PATTERN_DUTY_MAX //!< Paso siempre encendido
+#define OFF  0                //!< Paso siempre apagado
+
+#define MS(time) ((time) * PATTERN_TICKS_PER_SECOND / 1000) //!< Convierte una duración en milisegundos a ticks
+#define LEVEL(level) ((level) * PATTERN_DUTY_MAX / 10)      //!< Convierte un nivel de 0 a 10 a ciclo de trabajo
+
+#ifndef PATTERN_PLAYERS_MAX
+#define PATTERN_PLAYERS_MAX 2 //!< Cantidad máxima de reproductores de secuencias, reservados en memoria estática
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+/*! Estructura que representa un reproductor de secuencias */
+struct pattern_player_s {
+    digital_output_t output; //!< Salida sobre la que se reproducen las secuencias
+    pattern_t pattern;       //!< Secuencia en reproducción, NULL si está detenido
+    uint8_t step;            //!< Paso actual de la secuencia
+    uint8_t repeat;          //!< Repeticiones que faltan, cero si la secuencia no termina nunca
+    uint16_t remaining;      //!< Ticks que faltan para terminar el paso actual
+    uint8_t phase;           //!< Tick actual dentro del período de modulación
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Avanza al paso siguiente, a la repetición siguiente o a la secuencia siguiente
+ *
+ * @param self Puntero al reproductor
+ */
+static void PatternNextStep(pattern_player_t self);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Reproductores disponibles y cantidad ya creados
+static struct pattern_player_s players[PATTERN_PLAYERS_MAX];
+static uint16_t players_used;
+
+//! Pasos de dos pitidos cortos seguidos de una pausa
+static const pattern_step_t BEEP_BEEP_STEPS[] = {
+    {MS(100), ON}, {MS(100), OFF}, {MS(100), ON}, {MS(700), OFF},
+};
+
+//! Pasos de pitidos dobles con volumen creciente
+static const pattern_step_t ESCALATING_STEPS[] = {
+    {MS(100), LEVEL(3)}, {MS(100), OFF}, {MS(100), LEVEL(3)}, {MS(700), OFF},
+    {MS(100), LEVEL(5)}, {MS(100), OFF}, {MS(100), LEVEL(5)}, {MS(700), OFF},
+    {MS(100), LEVEL(8)}, {MS(100), OFF}, {MS(100), LEVEL(8)}, {MS(700), OFF},
+};
+
+//! Pasos de un encendido y apagado gradual
+static const pattern_step_t BREATHE_STEPS[] = {
+    {MS(100), LEVEL(0)}, {MS(100), LEVEL(1)}, {MS(100), LEVEL(2)}, {MS(100), LEVEL(3)}, {MS(100), LEVEL(4)},
+    {MS(100), LEVEL(5)}, {MS(100), LEVEL(6)}, {MS(100), LEVEL(7)}, {MS(100), LEVEL(8)}, {MS(100), LEVEL(9)},
+    {MS(100), LEVEL(10)}, {MS(100), LEVEL(9)}, {MS(100), LEVEL(8)}, {MS(100), LEVEL(7)}, {MS(100), LEVEL(6)},
+    {MS(100), LEVEL(5)}, {MS(100), LEVEL(4)}, {MS(100), LEVEL(3)}, {MS(100), LEVEL(2)}, {MS(100), LEVEL(1)},
+};
+
+/* === Public variable definitions ================================================================================= */
+
+const struct pattern_s PATTERN_BEEP_BEEP = {
+    .steps = BEEP_BEEP_STEPS,
+    .length = sizeof(BEEP_BEEP_STEPS) / sizeof(BEEP_BEEP_STEPS[0]),
+    .repeat = PATTERN_FOREVER,
+};
+
+const struct pattern_s PATTERN_ESCALATING = {
+    .steps = ESCALATING_STEPS,
+    .length = sizeof(ESCALATING_STEPS) / sizeof(ESCALATING_STEPS[0]),
+    .repeat = 1,
+    .next = &PATTERN_BEEP_BEEP,
+};
+
+const struct pattern_s PATTERN_BREATHE = {
+    .steps = BREATHE_STEPS,
+    .length = sizeof(BREATHE_STEPS) / sizeof(BREATHE_STEPS[0]),
+    .repeat = PATTERN_FOREVER,
+};
+
+/* === Private function definitions ================================================================================ */
+
+static void PatternNextStep(pattern_player_t self) {
+    self->step++;
+    if (self->step >= self->pattern->length) {
+        self->step = 0;
+        if (self->repeat > 1) {
+            self->repeat--;
+        } else if (self->repeat == 1) {
+            if (self->pattern->next != NULL) {
+                PatternPlay(self, self->pattern->next);
+            } else {
+                PatternStop(self);
+            }
+            return;
+        }
+    }
+    self->remaining = self->pattern->steps[self->step].duration;
+}
+
+/* === Public function implementation ============================================================================== */
+
+pattern_player_t PatternPlayerCreate(digital_output_t output) {
+    pattern_player_t self = NULL;
+    if (players_used < PATTERN_PLAYERS_MAX) {
+        self = &players[players_used++];
+        self->output = output;
+        self->pattern = NULL;
+    }
+    return self;
+}
+
+void PatternPlay(pattern_player_t self, pattern_t pattern) {
+    uint32_t primask = __get_PRIMASK();
+
+    /* El barrido interrumpe al temporizador de tiempo y al programa principal, no debe ver la secuencia nueva con el
+     * paso de la anterior */
+    __disable_irq();
+    self->step = 0;
+    self->phase = 0;
+    self->repeat = pattern->repeat;
+    self->remaining = pattern->steps[0].duration;
+    self->pattern = pattern;
+    __set_PRIMASK(primask);
+}
+
+void PatternStop(pattern_player_t self) {
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    self->pattern = NULL;
+    DigitalOutputDeactivate(self->output);
+    __set_PRIMASK(primask);
+}
+
+bool PatternIsPlaying(pattern_player_t self) {
+    return self->pattern != NULL;
+}
+
+void PatternTick(pattern_player_t self) {
+    if (self->pattern == NULL) {
+        return;
+    }
+
+    if (self->phase < self->pattern->steps[self->step].duty) {
+        DigitalOutputActivate(self->output);
+    } else {
+        DigitalOutputDeactivate(self->output);
+    }
+    self->phase = (self->phase + 1) % PATTERN_DUTY_MAX;
+
+    if (self->remaining > 1) {
+        self->remaining--;
+    } else {
+        PatternNextStep(self);
+    }
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,170 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file profile.c
+ ** @brief Código fuente del módulo que mide el tiempo de ejecución de regiones del código
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#ifndef __arm__
+#define _POSIX_C_SOURCE 199309L // clock_gettime de POSIX en la PC
+#endif
+
+#include "profile.h"
+#include "chip.h"
+#include <stddef.h>
+#include <string.h>
+#ifndef __arm__
+#include <time.h>
+#endif
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/*! Estadísticas acumuladas de una región */
+struct profile_region_s {
+    const char * name;                    //!< Nombre de la región
+    uint32_t count;                       //!< Cantidad de ejecuciones medidas
+    uint32_t min;                         //!< Duración mínima
+    uint32_t max;                         //!< Duración máxima
+    uint64_t total;                       //!< Suma de las duraciones, para el promedio
+    uint32_t histogram[PROFILE_BUCKETS];  //!< Ejecuciones en cada intervalo de duración
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula el intervalo del histograma que corresponde a una duración
+ *
+ * @param duration Duración medida
+ * @return uint8_t Intervalo, cada uno cubre el doble de duraciones que el anterior
+ */
+static uint8_t ProfileBucket(uint32_t duration);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Tabla de regiones medidas, en el orden en que terminaron por primera vez
+static struct profile_region_s regions[PROFILE_REGIONS_MAX];
+
+//! Cantidad de entradas usadas de la tabla
+static uint8_t regions_used;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function implementation ============================================================================= */
+
+static uint8_t ProfileBucket(uint32_t duration) {
+    uint8_t bits = (duration == 0) ? 0 : (uint8_t)(32 - __builtin_clz(duration));
+
+    if (bits <= PROFILE_BUCKET_SHIFT) {
+        return 0;
+    }
+    bits -= PROFILE_BUCKET_SHIFT;
+    return (bits < PROFILE_BUCKETS) ? bits : PROFILE_BUCKETS - 1;
+}
+
+/* === Public function implementation ============================================================================== */
+
+#ifdef __arm__
+void ProfileInit(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+uint32_t ProfileNow(void) {
+    return DWT->CYCCNT;
+}
+#else
+void ProfileInit(void) {
+}
+
+uint32_t ProfileNow(void) {
+    struct timespec now;
+
+    /* Como el contador del Cortex-M, da la vuelta y solo sirve para restar instantes cercanos */
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec);
+}
+#endif
+
+void ProfileRecord(profile_region_t * region, const char * name, uint32_t duration) {
+    profile_region_t self;
+    uint8_t bucket = ProfileBucket(duration);
+
+    /* Las regiones se pueden medir desde interrupciones de distinta prioridad */
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    self = *region;
+    if ((self == NULL) && (regions_used < PROFILE_REGIONS_MAX)) {
+        self = &regions[regions_used++];
+        self->name = name;
+        self->min = UINT32_MAX;
+        *region = self;
+    }
+    if (self != NULL) {
+        self->count++;
+        self->total += duration;
+        if (duration < self->min) {
+            self->min = duration;
+        }
+        if (duration > self->max) {
+            self->max = duration;
+        }
+        self->histogram[bucket]++;
+    }
+    __set_PRIMASK(primask);
+}
+
+bool ProfileGetStats(uint8_t index, profile_stats_t * stats) {
+    profile_region_t self;
+
+    if (index >= regions_used) {
+        return false;
+    }
+    self = &regions[index];
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    stats->name = self->name;
+    stats->count = self->count;
+    stats->min = (self->count > 0) ? self->min : 0;
+    stats->max = self->max;
+    stats->mean = (self->count > 0) ? (uint32_t)(self->total / self->count) : 0;
+    memcpy(stats->histogram, self->histogram, sizeof(stats->histogram));
+    __set_PRIMASK(primask);
+    return true;
+}
+
+void ProfileReset(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    for (uint8_t index = 0; index < regions_used; index++) {
+        regions[index].count = 0;
+        regions[index].min = UINT32_MAX;
+        regions[index].max = 0;
+        regions[index].total = 0;
+        memset(regions[index].histogram, 0, sizeof(regions[index].histogram));
+    }
+    __set_PRIMASK(primask);
+}
+
+/* === End of documentation ======================================================================================== */
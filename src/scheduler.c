@@ -0,0 +1,194 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file scheduler.c
+ ** @brief Código fuente del planificador cooperativo de tareas
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "scheduler.h"
+#include "chip.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#ifndef SCHEDULER_MAX_INSTANCES
+#define SCHEDULER_MAX_INSTANCES 1 //!< Cantidad máxima de planificadores, reservados en memoria estática
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+/*! Estructura que representa un planificador */
+struct scheduler_s {
+    scheduler_task_t * tasks; //!< Tabla de tareas
+    uint8_t count;            //!< Cantidad de tareas de la tabla
+    scheduler_sleep_t sleep;  //!< Función para dormir sin tareas activas
+    volatile uint32_t now;    //!< Ticks desde la creación
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Activa una tarea. Si seguía activa se conserva la activación anterior y, si es periódica, perdió un plazo.
+ *
+ * @param self Planificador
+ * @param task Tarea a activar
+ */
+static void Release(scheduler_t self, scheduler_task_t * task);
+
+/**
+ * @brief Busca la tarea activa de mayor prioridad
+ *
+ * @param self Planificador
+ * @return scheduler_task_t* Tarea encontrada, o NULL si no hay ninguna activa
+ */
+static scheduler_task_t * NextReady(scheduler_t self);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Planificadores disponibles y cantidad ya creados
+static struct scheduler_s instances[SCHEDULER_MAX_INSTANCES];
+static uint16_t instances_used;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function implementation ============================================================================= */
+
+static void Release(scheduler_t self, scheduler_task_t * task) {
+    if (task->ready) {
+        if (task->period != 0) {
+            task->stats.misses++;
+        }
+    } else {
+        task->released = self->now;
+        task->ready = true;
+    }
+}
+
+static scheduler_task_t * NextReady(scheduler_t self) {
+    scheduler_task_t * result = NULL;
+
+    for (uint8_t index = 0; index < self->count; index++) {
+        if (self->tasks[index].ready && ((result == NULL) || (self->tasks[index].priority < result->priority))) {
+            result = &self->tasks[index];
+        }
+    }
+    return result;
+}
+
+/* === Public function implementation ============================================================================== */
+
+scheduler_t SchedulerCreate(scheduler_task_t * tasks, uint8_t count, scheduler_sleep_t sleep) {
+    scheduler_t self;
+
+    if ((tasks == NULL) || (instances_used >= SCHEDULER_MAX_INSTANCES)) {
+        return NULL;
+    }
+    self = &instances[instances_used++];
+    self->tasks = tasks;
+    self->count = count;
+    self->sleep = sleep;
+    self->now = 0;
+    for (uint8_t index = 0; index < count; index++) {
+        tasks[index].ready = false;
+        tasks[index].countdown = tasks[index].period;
+        tasks[index].released = 0;
+        memset(&tasks[index].stats, 0, sizeof(tasks[index].stats));
+    }
+    return self;
+}
+
+void SchedulerTick(scheduler_t self) {
+    self->now++;
+    for (uint8_t index = 0; index < self->count; index++) {
+        scheduler_task_t * task = &self->tasks[index];
+
+        if ((task->period != 0) && (--task->countdown == 0)) {
+            task->countdown = task->period;
+            Release(self, task);
+        }
+    }
+}
+
+void SchedulerSignal(scheduler_t self, uint8_t task) {
+    uint32_t primask;
+
+    /* Puede llegar desde el programa principal o desde una interrupción que interrumpe a SchedulerTick() */
+    if (task < self->count) {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        Release(self, &self->tasks[task]);
+        __set_PRIMASK(primask);
+    }
+}
+
+bool SchedulerDispatch(scheduler_t self) {
+    scheduler_task_t * task;
+    uint32_t released;
+    uint32_t latency;
+    uint16_t deadline;
+    uint32_t primask;
+
+    /* Si no hay nada para hacer se duerme sin desbloquear las interrupciones: la que llegue en el medio despierta */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    task = NextReady(self);
+    if (task == NULL) {
+        if (self->sleep != NULL) {
+            self->sleep();
+        }
+        __set_PRIMASK(primask);
+        return false;
+    }
+    task->ready = false;
+    released = task->released;
+    latency = self->now - released;
+    __set_PRIMASK(primask);
+
+    task->function(task->context);
+
+    /* Las interrupciones también cuentan plazos perdidos de la misma tarea, las estadísticas se actualizan juntas */
+    deadline = (task->deadline != 0) ? task->deadline : task->period;
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (latency > task->stats.max_latency) {
+        task->stats.max_latency = (latency > UINT16_MAX) ? UINT16_MAX : latency;
+    }
+    task->stats.runs++;
+    if ((deadline != 0) && ((self->now - released) > deadline)) {
+        task->stats.misses++;
+    }
+    __set_PRIMASK(primask);
+    return true;
+}
+
+void SchedulerGetStats(scheduler_t self, uint8_t task, scheduler_stats_t * stats) {
+    uint32_t primask;
+
+    if ((task < self->count) && (stats != NULL)) {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        *stats = self->tasks[task].stats;
+        __set_PRIMASK(primask);
+    }
+}
+
+/* === End of documentation ======================================================================================== */
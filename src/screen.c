@@ -24,8 +24,8 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "screen.h"
-#include "poncho.h"
-#include <stdlib.h>
+#include "chip.h"
+#include "latency.h"
 #include <string.h>
 #include <stdint.h>
 
@@ -35,6 +35,33 @@ SPDX-License-Identifier: MIT
 #define SCREEN_MAX_DIGITS 8
 #endif
 
+/* Las imágenes son de un byte, una placa con los segmentos más arriba en el puerto necesita otro driver */
+#if (SCREEN_SEGMENT_A_BIT > 7) || (SCREEN_SEGMENT_B_BIT > 7) || (SCREEN_SEGMENT_C_BIT > 7) ||                          \
+    (SCREEN_SEGMENT_D_BIT > 7) || (SCREEN_SEGMENT_E_BIT > 7) || (SCREEN_SEGMENT_F_BIT > 7) ||                          \
+    (SCREEN_SEGMENT_G_BIT > 7) || (SCREEN_SEGMENT_P_BIT > 7)
+#error "Los segmentos de la pantalla deben ocupar los 8 bits menos significativos de la palabra"
+#endif
+
+#ifndef SCREEN_MAX_INSTANCES
+#define SCREEN_MAX_INSTANCES 1 //!< Cantidad máxima de pantallas, reservadas en memoria estática
+#endif
+
+#ifndef SCREEN_SCROLL_MAX_LENGTH
+#define SCREEN_SCROLL_MAX_LENGTH 32
+#endif
+
+#ifndef SCREEN_TICK_RATE
+#define SCREEN_TICK_RATE 1000 //!< Llamadas a ScreenRefresh por segundo si no se indica otro valor
+#endif
+
+#ifndef SCREEN_MIN_FRAME_RATE
+#define SCREEN_MIN_FRAME_RATE 60 //!< Cuadros por segundo mínimos para que el ojo no perciba parpadeo
+#endif
+
+#ifndef SCREEN_FLASH_FRAME_RATE
+#define SCREEN_FLASH_FRAME_RATE 100 //!< Cuadros por segundo mínimos mientras hay dígitos parpadeando
+#endif
+
 
 /* === Private data type declarations ============================================================================== */
 
@@ -42,76 +69,356 @@ struct screen_s{
     uint8_t digits;
     uint8_t value[SCREEN_MAX_DIGITS];
     uint8_t current_digit;
+    volatile uint8_t changed; //!< Dígitos cambiados que el barrido todavía no encendió, para medir la latencia
 
     struct {
         uint8_t Digits_from;
         uint8_t Digits_to;
-        uint8_t Digits_count;
+        uint16_t Digits_count;
         uint16_t Digits_frecuency;
     }flashing[1];
 
+    struct {
+        uint16_t tick_rate;  //!< Mayor cantidad de llamadas a ScreenRefresh por segundo, la base de los cuadros
+        uint16_t rate;       //!< Llamadas a ScreenRefresh por segundo que se esperan, cero si el barrido está detenido
+        uint16_t divisor;    //!< Llamadas a ScreenRefresh entre cada barrido de un dígito
+        uint16_t period;     //!< Llamadas a la frecuencia base entre cada barrido de un dígito
+        uint16_t count;      //!< Llamadas transcurridas desde el último barrido
+        uint8_t brightness;  //!< Brillo actual, de 1 a SCREEN_BRIGHTNESS_MAX
+        uint16_t off_at;     //!< Llamada en la que se apaga el dígito para reducir el brillo, cero si no se atenúa
+        bool idle;           //!< No hay nada encendido, el barrido se detiene si el driver lo permite
+    }refresh[1];
+
+    struct {
+        uint8_t segments[SCREEN_MAX_DIGITS + SCREEN_SCROLL_MAX_LENGTH + SCREEN_MAX_DIGITS]; //!< Texto ya codificado
+        uint8_t length;   //!< Cantidad de posiciones que recorre la ventana antes de repetir
+        uint8_t offset;   //!< Posición actual de la ventana dentro del texto codificado
+        uint16_t count;   //!< Cuadros base transcurridos desde el último desplazamiento
+        uint16_t divisor; //!< Cuadros base entre desplazamientos, cero si no hay desplazamiento activo
+    }scroll[1];
+
+    const uint8_t * window; //!< Imágenes que se muestran en cada dígito
     screen_driver_t driver;
     
 };
 
-static const uint8_t IMAGES[10] = {
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E |SEGMENT_F, //0
-    SEGMENT_B | SEGMENT_C, //1
-    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,//2
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,//3
-    SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,//4
-    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,//5
-    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,//6
-    SEGMENT_A | SEGMENT_B | SEGMENT_C,//7
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,//8
-    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G //9
+/* Imágenes de los caracteres representables en un display de 7 segmentos */
+#define GLYPH_0 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F)
+#define GLYPH_1 (SEGMENT_B | SEGMENT_C)
+#define GLYPH_2 (SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G)
+#define GLYPH_3 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G)
+#define GLYPH_4 (SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G)
+#define GLYPH_5 (SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G)
+#define GLYPH_6 (SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_7 (SEGMENT_A | SEGMENT_B | SEGMENT_C)
+#define GLYPH_8 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_9 (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G)
+#define GLYPH_A (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_B (SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_C (SEGMENT_A | SEGMENT_D | SEGMENT_E | SEGMENT_F)
+#define GLYPH_C_LOWER (SEGMENT_D | SEGMENT_E | SEGMENT_G)
+#define GLYPH_D (SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_G)
+#define GLYPH_E (SEGMENT_A | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_F (SEGMENT_A | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_G (SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F)
+#define GLYPH_H (SEGMENT_B | SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_H_LOWER (SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_I (SEGMENT_E | SEGMENT_F)
+#define GLYPH_J (SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E)
+#define GLYPH_L (SEGMENT_D | SEGMENT_E | SEGMENT_F)
+#define GLYPH_N (SEGMENT_C | SEGMENT_E | SEGMENT_G)
+#define GLYPH_O_LOWER (SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_G)
+#define GLYPH_P (SEGMENT_A | SEGMENT_B | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_Q (SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G)
+#define GLYPH_R (SEGMENT_E | SEGMENT_G)
+#define GLYPH_T (SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G)
+#define GLYPH_U (SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F)
+#define GLYPH_U_LOWER (SEGMENT_C | SEGMENT_D | SEGMENT_E)
+#define GLYPH_Y (SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G)
+#define GLYPH_MINUS (SEGMENT_G)
+#define GLYPH_UNDERSCORE (SEGMENT_D)
+#define GLYPH_EQUAL (SEGMENT_D | SEGMENT_G)
+#define GLYPH_BLANK (0)
+
+/**
+ * @brief Imágenes indexadas por valor BCD/hexadecimal y códigos especiales.
+ *
+ * La tabla cubre todos los valores posibles de un uint8_t, por lo que la indexación nunca sale de rango: los códigos
+ * no definidos quedan en cero y se muestran apagados.
+ */
+static const uint8_t IMAGES[UINT8_MAX + 1] = {
+    [0x0] = GLYPH_0, [0x1] = GLYPH_1, [0x2] = GLYPH_2, [0x3] = GLYPH_3,
+    [0x4] = GLYPH_4, [0x5] = GLYPH_5, [0x6] = GLYPH_6, [0x7] = GLYPH_7,
+    [0x8] = GLYPH_8, [0x9] = GLYPH_9, [0xA] = GLYPH_A, [0xB] = GLYPH_B,
+    [0xC] = GLYPH_C, [0xD] = GLYPH_D, [0xE] = GLYPH_E, [0xF] = GLYPH_F,
+    [SCREEN_GLYPH_BLANK] = GLYPH_BLANK,
+    [SCREEN_GLYPH_MINUS] = GLYPH_MINUS,
+};
+
+/**
+ * @brief Imágenes indexadas por código ASCII.
+ *
+ * Igual que la tabla anterior cubre los 256 códigos posibles; los caracteres sin representación quedan apagados.
+ */
+static const uint8_t TEXT_IMAGES[UINT8_MAX + 1] = {
+    ['0'] = GLYPH_0, ['1'] = GLYPH_1, ['2'] = GLYPH_2, ['3'] = GLYPH_3, ['4'] = GLYPH_4,
+    ['5'] = GLYPH_5, ['6'] = GLYPH_6, ['7'] = GLYPH_7, ['8'] = GLYPH_8, ['9'] = GLYPH_9,
+    ['A'] = GLYPH_A, ['a'] = GLYPH_A,
+    ['B'] = GLYPH_B, ['b'] = GLYPH_B,
+    ['C'] = GLYPH_C, ['c'] = GLYPH_C_LOWER,
+    ['D'] = GLYPH_D, ['d'] = GLYPH_D,
+    ['E'] = GLYPH_E, ['e'] = GLYPH_E,
+    ['F'] = GLYPH_F, ['f'] = GLYPH_F,
+    ['G'] = GLYPH_G, ['g'] = GLYPH_G,
+    ['H'] = GLYPH_H, ['h'] = GLYPH_H_LOWER,
+    ['I'] = GLYPH_I, ['i'] = GLYPH_I,
+    ['J'] = GLYPH_J, ['j'] = GLYPH_J,
+    ['L'] = GLYPH_L, ['l'] = GLYPH_L,
+    ['N'] = GLYPH_N, ['n'] = GLYPH_N,
+    ['O'] = GLYPH_0, ['o'] = GLYPH_O_LOWER,
+    ['P'] = GLYPH_P, ['p'] = GLYPH_P,
+    ['Q'] = GLYPH_Q, ['q'] = GLYPH_Q,
+    ['R'] = GLYPH_R, ['r'] = GLYPH_R,
+    ['S'] = GLYPH_5, ['s'] = GLYPH_5,
+    ['T'] = GLYPH_T, ['t'] = GLYPH_T,
+    ['U'] = GLYPH_U, ['u'] = GLYPH_U_LOWER,
+    ['Y'] = GLYPH_Y, ['y'] = GLYPH_Y,
+    ['-'] = GLYPH_MINUS, ['_'] = GLYPH_UNDERSCORE, ['='] = GLYPH_EQUAL, [' '] = GLYPH_BLANK,
 };
 
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief Elige la menor frecuencia de barrido que no parpadea para el contenido y el brillo actuales
+ *
+ * Si el driver tiene ScanRateSet le pide la nueva cantidad de llamadas por segundo, solo cuando cambia.
+ *
+ * @param self Puntero a la instancia de la pantalla
+ */
+static void ScreenGovern(screen_t self);
+
+/**
+ * @brief Indica si la pantalla no tiene nada encendido: todos los dígitos en blanco y ningún desplazamiento
+ *
+ * @param self Puntero a la instancia de la pantalla
+ * @return true si no hay nada que barrer
+ */
+static bool ScreenIsIdle(screen_t self);
+
+/**
+ * @brief Guarda las imágenes de todos los dígitos y marca la publicación del cuadro si alguna cambió
+ *
+ * Cada dígito se guarda con una sola escritura, que el barrido no puede partir. Los dígitos cambiados se recuerdan
+ * hasta que el barrido los enciende, para medir la latencia de las teclas.
+ *
+ * @param self Puntero a la instancia de la pantalla
+ * @param frame Segmentos encendidos de cada dígito, en cero los que no tiene la pantalla
+ */
+static void ScreenStore(screen_t self, const uint8_t frame[SCREEN_MAX_DIGITS]);
+
 /* === Private variable definitions ================================================================================ */
 
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
+static void ScreenGovern(screen_t self){
+    uint16_t frame_rate = SCREEN_MIN_FRAME_RATE;
+    uint16_t slots = 1;
+    uint16_t step;
+    uint16_t previous = self->refresh->rate;
+    uint32_t primask;
+
+    /* Los dígitos que se encienden y apagan juntos hacen más visible el parpadeo del barrido, se barre más rápido */
+    if (self->flashing->Digits_frecuency != 0){
+        frame_rate = SCREEN_FLASH_FRAME_RATE;
+    }
+    /* La atenuación divide el tiempo de cada dígito en SCREEN_BRIGHTNESS_MAX pasos de igual duración */
+    if (self->refresh->brightness < SCREEN_BRIGHTNESS_MAX){
+        slots = SCREEN_BRIGHTNESS_MAX;
+    }
+    /* Cada paso dura todas las llamadas base que permite la frecuencia de cuadro, así se barre lo más lento posible */
+    step = self->refresh->tick_rate / (self->digits * frame_rate * slots);
+    if (step == 0){
+        step = 1;
+    }
+    self->refresh->idle = ScreenIsIdle(self);
+
+    /* El parpadeo y el desplazamiento cuentan en cuadros base, así que no dependen de la frecuencia elegida */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (self->driver->ScanRateSet != NULL){
+        /* El temporizador llama una vez por paso y se detiene si no hay nada encendido */
+        self->refresh->rate = self->refresh->idle ? 0 : self->refresh->tick_rate / step;
+        self->refresh->divisor = slots;
+        self->refresh->off_at = (slots > 1) ? self->refresh->brightness : 0;
+    } else {
+        /* Las llamadas llegan siempre a la frecuencia base, se dejan pasar las que sobran en cada paso */
+        self->refresh->rate = self->refresh->tick_rate;
+        self->refresh->divisor = step * slots;
+        self->refresh->off_at = (slots > 1) ? step * self->refresh->brightness : 0;
+    }
+    self->refresh->period = step * slots;
+    self->refresh->count = 0;
+    __set_PRIMASK(primask);
+
+    if ((self->driver->ScanRateSet != NULL) && (self->refresh->rate != previous)){
+        if (self->refresh->rate == 0){
+            self->driver->DigitsTurnOff();
+        }
+        self->driver->ScanRateSet(self->refresh->rate);
+    }
+}
+
+static bool ScreenIsIdle(screen_t self){
+    if (self->scroll->divisor != 0){
+        return false;
+    }
+    for (uint8_t i = 0; i < self->digits; i++){
+        if (self->value[i] != 0){
+            return false;
+        }
+    }
+    return true;
+}
+
+static void ScreenStore(screen_t self, const uint8_t frame[SCREEN_MAX_DIGITS]){
+#if LATENCY_ENABLED
+    uint8_t changed = 0;
+
+    for (uint8_t i = 0; i < SCREEN_MAX_DIGITS; i++){
+        if (self->value[i] != frame[i]){
+            changed |= (1 << i);
+        }
+        self->value[i] = frame[i];
+    }
+    if (changed != 0){
+        /* El barrido borra los dígitos que enciende, sin bloqueo se podría perder uno de los dos cambios */
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        self->changed |= changed;
+        __set_PRIMASK(primask);
+        LatencyMark(LATENCY_PUBLISHED);
+    }
+#else
+    for (uint8_t i = 0; i < SCREEN_MAX_DIGITS; i++){
+        self->value[i] = frame[i];
+    }
+#endif
+    /* Solo si el driver puede detener el barrido importa que la pantalla quede en blanco o deje de estarlo */
+    if ((self->driver->ScanRateSet != NULL) && (ScreenIsIdle(self) != self->refresh->idle)){
+        ScreenGovern(self);
+    }
+}
 
 /* === Public function implementation ============================================================================== */
 screen_t ScreenCreate(uint8_t digits, screen_driver_t driver){
-    screen_t self = malloc(sizeof(struct screen_s));
+    static struct screen_s instances[SCREEN_MAX_INSTANCES];
+    static uint16_t used = 0;
+    screen_t self = NULL;
+
     if (digits > SCREEN_MAX_DIGITS){
         digits = SCREEN_MAX_DIGITS;
     }
-    if (self != NULL){
+    if (used < SCREEN_MAX_INSTANCES){
+        self = &instances[used++];
         self ->digits = digits;
         self->driver = driver;
         self->current_digit = 0;
         self->flashing->Digits_count = 0;
         self->flashing->Digits_frecuency = 0;
+        self->scroll->divisor = 0;
+        self->window = self->value;
+        self->refresh->tick_rate = SCREEN_TICK_RATE;
+        self->refresh->rate = UINT16_MAX; /* Ninguna frecuencia válida, así el driver recibe la primera */
+        self->refresh->brightness = SCREEN_BRIGHTNESS_MAX;
+        ScreenGovern(self);
     }
     return self;
 }
 
 void ScreenWriteBCD(screen_t self, uint8_t  value[], uint8_t size){
-    memset(self->value,0,sizeof(self->value));
+    uint8_t frame[SCREEN_MAX_DIGITS] = {0};
+
     if (size > self->digits){
         size = self->digits;
     }
     for (uint8_t i = 0; i < size; i++){
-        self->value[i]=IMAGES[value[i]];
+        frame[i] = IMAGES[value[i]];
     }
+    ScreenStore(self, frame);
+}
+
+void ScreenPublishBCD(screen_t self, const uint8_t value[], uint8_t size, uint8_t dots){
+    uint8_t frame[SCREEN_MAX_DIGITS] = {0};
+
+    /* Cada dígito se arma completo y se guarda con una sola escritura, que el barrido no puede partir */
+    for (uint8_t i = 0; i < self->digits; i++){
+        frame[i] = (i < size) ? IMAGES[value[i]] : 0;
+        if (dots & (1 << i)){
+            frame[i] |= SEGMENT_P;
+        }
+    }
+    ScreenStore(self, frame);
+}
+
+void ScreenWriteSegments(screen_t self, const uint8_t segments[], uint8_t size){
+    uint8_t frame[SCREEN_MAX_DIGITS] = {0};
+
+    if ((!self) || (!segments)){
+        return;
+    }
+    if (size > self->digits){
+        size = self->digits;
+    }
+    memcpy(frame, segments, size);
+    ScreenStore(self, frame);
+}
+
+void ScreenWriteText(screen_t self, const char * text){
+    uint8_t frame[SCREEN_MAX_DIGITS] = {0};
+
+    if ((!self) || (!text)){
+        return;
+    }
+    for (uint8_t i = 0; (i < self->digits) && (text[i] != '\0'); i++){
+        frame[i] = TEXT_IMAGES[(uint8_t)text[i]];
+    }
+    ScreenStore(self, frame);
 }
 
 void ScreenRefresh(screen_t self){
     uint8_t segments;
 
+    self->refresh->count++;
+    if (self->refresh->count < self->refresh->divisor){
+        if (self->refresh->count == self->refresh->off_at){
+            self->driver->DigitsTurnOff();
+        }
+        return;
+    }
+    self->refresh->count = 0;
+
     self->driver->DigitsTurnOff();
     self->current_digit = (self->current_digit + 1) % self->digits;
     
-    segments = self->value[self->current_digit];
+    if ((self->scroll->divisor != 0) && (self->current_digit == 0)){
+        self->scroll->count += self->refresh->period;
+        if (self->scroll->count >= self->scroll->divisor){
+            self->scroll->count = 0;
+            self->scroll->offset++;
+            if (self->scroll->offset >= self->scroll->length){
+                self->scroll->offset = 0;
+            }
+            self->window = &self->scroll->segments[self->scroll->offset];
+        }
+    }
+
+    segments = self->window[self->current_digit];
     if (self->flashing->Digits_frecuency != 0){
         if (self->current_digit == 0){
-            self->flashing->Digits_count = (self->flashing->Digits_count + 1) % (self->flashing->Digits_frecuency);
+            self->flashing->Digits_count =
+                (self->flashing->Digits_count + self->refresh->period) % (self->flashing->Digits_frecuency);
         }
         if (self->flashing->Digits_count < (self->flashing->Digits_frecuency / 2)){
             if (self->current_digit >= self->flashing->Digits_from){
@@ -124,6 +431,12 @@ void ScreenRefresh(screen_t self){
     }
     self->driver->SegmentsUpdate(segments);
     self->driver->DigitTurnOn(self->current_digit);
+#if LATENCY_ENABLED
+    if (self->changed & (1 << self->current_digit)){
+        self->changed &= ~(1 << self->current_digit);
+        LatencyMark(LATENCY_SHOWN);
+    }
+#endif
     
 }
 
@@ -139,19 +452,117 @@ int DisplayFlashDigits(screen_t self, uint8_t from, uint8_t to, uint16_t divisor
             self->flashing->Digits_to = to;
             self->flashing->Digits_frecuency = 2 * divisor;
             self->flashing->Digits_count = 0;
+            ScreenGovern(self);
+    }
+
+    return result;
+}
+
+int ScreenStartScroll(screen_t self, const char * text, uint16_t divisor){
+    int result = 0;
+    uint8_t length;
+
+    if ((!self) || (!text) || (divisor == 0)){
+        result = -1;
+    } else if (strlen(text) > SCREEN_SCROLL_MAX_LENGTH){
+        result = -1;
+    } else {
+        /* El recorrido empieza con la pantalla en blanco y el texto entra por la derecha */
+        length = self->digits;
+        memset(self->scroll->segments, 0, length);
+        for (uint8_t i = 0; text[i] != '\0'; i++){
+            self->scroll->segments[length++] = TEXT_IMAGES[(uint8_t)text[i]];
+        }
+        /* Se repite el comienzo al final para que la ventana nunca tenga que dar la vuelta */
+        memcpy(&self->scroll->segments[length], self->scroll->segments, self->digits);
+
+        self->scroll->length = length;
+        self->scroll->offset = 0;
+        self->scroll->count = 0;
+        self->scroll->divisor = divisor;
+        self->window = self->scroll->segments;
+        ScreenGovern(self);
     }
 
     return result;
 }
 
+void ScreenStopScroll(screen_t self){
+    if (!self){
+        return;
+    }
+    self->scroll->divisor = 0;
+    self->window = self->value;
+    ScreenGovern(self);
+}
+
+bool ScreenIsScrolling(screen_t self){
+    if (!self){
+        return false;
+    }
+    return self->scroll->divisor != 0;
+}
+
+void ScreenSetTickRate(screen_t self, uint16_t ticks_per_second){
+    if ((!self) || (ticks_per_second == 0)){
+        return;
+    }
+    self->refresh->tick_rate = ticks_per_second;
+    ScreenGovern(self);
+}
+
+void ScreenSetBrightness(screen_t self, uint8_t brightness){
+    if (!self){
+        return;
+    }
+    if (brightness == 0){
+        brightness = 1;
+    } else if (brightness > SCREEN_BRIGHTNESS_MAX){
+        brightness = SCREEN_BRIGHTNESS_MAX;
+    }
+    self->refresh->brightness = brightness;
+    ScreenGovern(self);
+}
+
+uint16_t ScreenGetScanRate(screen_t self){
+    if (!self){
+        return 0;
+    }
+    if (self->refresh->rate == 0){
+        return 0;
+    }
+    return self->refresh->tick_rate / self->refresh->period;
+}
+
+uint16_t ScreenGetRefreshRate(screen_t self){
+    if (!self){
+        return 0;
+    }
+    return self->refresh->rate;
+}
+
 void ScreenToggleDot(screen_t self, uint8_t position) {
-    self->value[position] ^= SEGMENT_P;
+    uint8_t frame[SCREEN_MAX_DIGITS];
+
+    if ((!self) || (position >= self->digits)){
+        return;
+    }
+    memcpy(frame, self->value, sizeof(frame));
+    frame[position] ^= SEGMENT_P;
+    ScreenStore(self, frame);
 }
 
 void ScreenSetDot(screen_t self, uint8_t position, bool on) {
+    uint8_t frame[SCREEN_MAX_DIGITS];
+
+    if ((!self) || (position >= self->digits)){
+        return;
+    }
+    memcpy(frame, self->value, sizeof(frame));
     if (on)
-        self->value[position] |= SEGMENT_P;
+        frame[position] |= SEGMENT_P;
     else
-        self->value[position] &= ~SEGMENT_P;
+        frame[position] &= ~SEGMENT_P;
+    ScreenStore(self, frame);
 }
 /* === End of documentation ======================================================================================== */
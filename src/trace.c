@@ -0,0 +1,137 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file trace.c
+ ** @brief Código fuente del registro binario de eventos
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "trace.h"
+#include "chip.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+#define TRACE_DELTA_BITS 16 //!< Bits del tiempo de un registro
+
+#if (TRACE_RECORDS & (TRACE_RECORDS - 1)) != 0
+#error "TRACE_RECORDS debe ser una potencia de dos"
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Lee el contador de ciclos del núcleo
+ *
+ * @return uint32_t Ciclos desde un origen arbitrario
+ */
+static uint32_t TraceNow(void);
+
+/**
+ * @brief Guarda un registro en la próxima posición del anillo, se llama con las interrupciones bloqueadas
+ *
+ * @param delta Tiempo desde el registro anterior
+ * @param event Evento
+ * @param payload Dato del evento
+ */
+static void TraceStore(uint16_t delta, uint8_t event, uint8_t payload);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Anillo de registros, con la cabecera para decodificar una copia de la memoria
+static trace_buffer_t trace;
+
+//! Ciclo del último registro, sin la parte que no llegó a una unidad de tiempo
+static uint32_t trace_last;
+
+//! Eventos que se registran
+static uint32_t trace_mask;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function implementation ============================================================================= */
+
+static uint32_t TraceNow(void) {
+#ifdef __arm__
+    return DWT->CYCCNT;
+#else
+    return HostCoreCycles();
+#endif
+}
+
+static void TraceStore(uint16_t delta, uint8_t event, uint8_t payload) {
+    trace_record_t * record = &trace.records[trace.written & (TRACE_RECORDS - 1)];
+
+    record->delta = delta;
+    record->event = event;
+    record->payload = payload;
+    trace.written++;
+}
+
+/* === Public function implementation ============================================================================== */
+
+void TraceInit(void) {
+#ifdef __arm__
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    SystemCoreClockUpdate();
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    memset(&trace, 0, sizeof(trace));
+    trace.magic = TRACE_MAGIC;
+    trace.clock = SystemCoreClock;
+    trace.shift = TRACE_TIME_SHIFT;
+    trace.capacity = TRACE_RECORDS;
+    trace_last = TraceNow();
+    trace_mask = TRACE_MASK;
+    __set_PRIMASK(primask);
+}
+
+void TraceRecord(uint8_t event, uint8_t payload) {
+    uint32_t delta;
+
+    if ((trace_mask & (1UL << event)) == 0) {
+        return;
+    }
+
+    /* El instante y la posición se toman juntos, para que los registros queden en orden de tiempo */
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    delta = (TraceNow() - trace_last) >> TRACE_TIME_SHIFT;
+    trace_last += delta << TRACE_TIME_SHIFT;
+    if (delta > UINT16_MAX) {
+        TraceStore((uint16_t)(delta >> TRACE_DELTA_BITS), TRACE_GAP, 0);
+    }
+    TraceStore((uint16_t)delta, event, payload);
+    __set_PRIMASK(primask);
+}
+
+void TraceSetMask(uint32_t mask) {
+    trace_mask = mask;
+}
+
+const trace_buffer_t * TraceGetBuffer(void) {
+    return &trace;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,266 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_bsp.c
+ ** @brief Pruebas unitarias de la inicialización de la placa usando el modelo de GPIO y SCU de la PC.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "bsp.h"
+#include "chip.h"
+#include "digital.h"
+#include "poncho.h"
+#include "screen.h" /* BoardCreate() crea la pantalla, así se enlaza screen.c con la prueba */
+#include "unity.h"
+#include <string.h>
+
+/**
+ * -La inicialización desde la tabla deja los pines igual que la inicialización pin por pin.
+ * -La inicialización desde la tabla escribe menos veces los puertos GPIO.
+ * -Las teclas quedan como entradas y los LEDs del RGB apagados.
+ * -El temporizador de tiempo usa el RIT con el período pedido y al vencer atiende la función registrada.
+ * -El temporizador de tiempo rechaza una frecuencia nula y cuenta el período en ciclos del reloj del RIT.
+ * -El temporizador de barrido usa la frecuencia que pide la pantalla y se detiene con la pantalla en blanco.
+ */
+
+/* === Macros definitions ========================================================================================== */
+
+/** Configuración de un pin como salida con un nivel inicial, como se hacía antes de la tabla de pines */
+#define PIN_OUTPUT(NAME, LEVEL)                                                                                        \
+    do {                                                                                                               \
+        Chip_SCU_PinMuxSet(NAME##_PORT, NAME##_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | NAME##_FUNC);                \
+        Chip_GPIO_SetPinState(LPC_GPIO_PORT, NAME##_GPIO, NAME##_BIT, LEVEL);                                          \
+        Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, NAME##_GPIO, NAME##_BIT, true);                                             \
+    } while (0)
+
+/** Configuración del modo de un pin sin tocar el puerto GPIO, como se hacía antes de la tabla de pines */
+#define PIN_MUX(NAME, MODE) Chip_SCU_PinMuxSet(NAME##_PORT, NAME##_PIN, SCU_MODE_INBUFF_EN | (MODE) | NAME##_FUNC)
+
+/* === Private data type declarations ============================================================================== */
+
+/*! Copia del estado de los periféricos para comparar dos inicializaciones */
+typedef struct snapshot_s {
+    uint32_t dir[HOST_GPIO_PORTS];                 //!< Dirección de los pines de cada puerto
+    uint32_t mask[HOST_GPIO_PORTS];                //!< Máscara de escritura de cada puerto
+    uint32_t pin[HOST_GPIO_PORTS];                 //!< Valor de las salidas de cada puerto
+    uint32_t sfsp[HOST_SCU_PORTS][HOST_SCU_PINS];  //!< Modo y función de cada pin
+    uint32_t writes;                               //!< Escrituras realizadas en los puertos GPIO
+} snapshot_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Inicializa la placa pin por pin, con la misma secuencia que usaba BoardCreate() antes de la tabla
+ */
+static void LegacyBoardInit(void);
+
+/**
+ * @brief Copia el estado actual de los puertos GPIO y del SCU
+ *
+ * @param snapshot Copia a completar
+ */
+static void TakeSnapshot(snapshot_t * snapshot);
+
+/**
+ * @brief Cuenta las interrupciones del temporizador de tiempo
+ */
+static void CountTicks(void);
+
+/**
+ * @brief Función de la hora virtual, las pruebas no imponen entradas
+ *
+ * @param now Sin uso
+ */
+static void IgnoreClock(uint64_t now);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Cantidad de veces que se ejecutó CountTicks()
+static uint32_t ticks_counted;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void LegacyBoardInit(void) {
+    digital_output_group_t leds;
+    digital_input_group_t keys;
+
+    PIN_OUTPUT(DIGIT_1, false);
+    PIN_OUTPUT(DIGIT_2, false);
+    PIN_OUTPUT(DIGIT_3, false);
+    PIN_OUTPUT(DIGIT_4, false);
+    PIN_OUTPUT(SEGMENT_A, false);
+    PIN_OUTPUT(SEGMENT_B, false);
+    PIN_OUTPUT(SEGMENT_C, false);
+    PIN_OUTPUT(SEGMENT_D, false);
+    PIN_OUTPUT(SEGMENT_E, false);
+    PIN_OUTPUT(SEGMENT_F, false);
+    PIN_OUTPUT(SEGMENT_G, false);
+    PIN_OUTPUT(SEGMENT_P, false);
+    Chip_GPIO_SetPortMask(LPC_GPIO_PORT, SEGMENTS_GPIO, ~SEGMENTS_MASK);
+
+    leds = DigitalOutputGroupCreate();
+    PIN_MUX(RGB_RED, SCU_MODE_INACT);
+    DigitalOutputGroupAdd(leds, RGB_RED_GPIO, RGB_RED_BIT, true);
+    PIN_MUX(RGB_GREEN, SCU_MODE_INACT);
+    DigitalOutputGroupAdd(leds, RGB_GREEN_GPIO, RGB_GREEN_BIT, true);
+    PIN_MUX(RGB_BLUE, SCU_MODE_INACT);
+    DigitalOutputGroupAdd(leds, RGB_BLUE_GPIO, RGB_BLUE_BIT, true);
+
+    PIN_MUX(BUZZER, SCU_MODE_INACT);
+    DigitalOutputGroupAdd(leds, BUZZER_GPIO, BUZZER_BIT, false);
+
+    keys = DigitalInputGroupCreate();
+    PIN_MUX(KEY_F1, SCU_MODE_PULLUP);
+    DigitalInputGroupAdd(keys, KEY_F1_GPIO, KEY_F1_BIT, true);
+    PIN_MUX(KEY_F2, SCU_MODE_PULLUP);
+    DigitalInputGroupAdd(keys, KEY_F2_GPIO, KEY_F2_BIT, true);
+    PIN_MUX(KEY_F3, SCU_MODE_PULLUP);
+    DigitalInputGroupAdd(keys, KEY_F3_GPIO, KEY_F3_BIT, true);
+    PIN_MUX(KEY_F4, SCU_MODE_PULLUP);
+    DigitalInputGroupAdd(keys, KEY_F4_GPIO, KEY_F4_BIT, true);
+    PIN_MUX(KEY_ACCEPT, SCU_MODE_INACT);
+    DigitalInputGroupAdd(keys, KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT, true);
+    PIN_MUX(KEY_CANCEL, SCU_MODE_INACT);
+    DigitalInputGroupAdd(keys, KEY_CANCEL_GPIO, KEY_CANCEL_BIT, true);
+}
+
+static void TakeSnapshot(snapshot_t * snapshot) {
+    memset(snapshot, 0, sizeof(*snapshot));
+    memcpy(snapshot->dir, LPC_GPIO_PORT->DIR, sizeof(snapshot->dir));
+    memcpy(snapshot->mask, LPC_GPIO_PORT->MASK, sizeof(snapshot->mask));
+    memcpy(snapshot->pin, LPC_GPIO_PORT->PIN, sizeof(snapshot->pin));
+    memcpy(snapshot->sfsp, LPC_SCU->SFSP, sizeof(snapshot->sfsp));
+    snapshot->writes = LPC_GPIO_PORT->WRITES;
+}
+
+static void CountTicks(void) {
+    ticks_counted++;
+}
+
+static void IgnoreClock(uint64_t now) {
+    (void)now;
+}
+
+/**
+ * @brief Setup que se ejecuta antes de cada test. Vuelve los periféricos al estado de reset.
+ */
+void setUp(void) {
+    HostGpioReset();
+    ticks_counted = 0;
+}
+
+/* === Public function implementation ============================================================================== */
+
+void test_table_matches_legacy_initialization(void) {
+    snapshot_t legacy, table;
+
+    LegacyBoardInit();
+    TakeSnapshot(&legacy);
+
+    HostGpioReset();
+    TEST_ASSERT_NOT_NULL(BoardCreate());
+    TakeSnapshot(&table);
+
+    TEST_ASSERT_EQUAL_MEMORY(legacy.dir, table.dir, sizeof(legacy.dir));
+    TEST_ASSERT_EQUAL_MEMORY(legacy.mask, table.mask, sizeof(legacy.mask));
+    TEST_ASSERT_EQUAL_MEMORY(legacy.pin, table.pin, sizeof(legacy.pin));
+    TEST_ASSERT_EQUAL_MEMORY(legacy.sfsp, table.sfsp, sizeof(legacy.sfsp));
+}
+
+void test_table_initialization_needs_fewer_writes(void) {
+    snapshot_t legacy, table;
+
+    LegacyBoardInit();
+    TakeSnapshot(&legacy);
+
+    HostGpioReset();
+    BoardCreate();
+    TakeSnapshot(&table);
+
+    TEST_ASSERT_LESS_THAN(legacy.writes, table.writes);
+}
+
+void test_keys_are_inputs_and_rgb_starts_off(void) {
+    BoardCreate();
+
+    TEST_ASSERT_BIT_LOW(KEY_F1_BIT, LPC_GPIO_PORT->DIR[KEY_F1_GPIO]);
+    TEST_ASSERT_BIT_LOW(KEY_F2_BIT, LPC_GPIO_PORT->DIR[KEY_F2_GPIO]);
+    TEST_ASSERT_BIT_LOW(KEY_F3_BIT, LPC_GPIO_PORT->DIR[KEY_F3_GPIO]);
+    TEST_ASSERT_BIT_LOW(KEY_F4_BIT, LPC_GPIO_PORT->DIR[KEY_F4_GPIO]);
+    TEST_ASSERT_BIT_LOW(KEY_ACCEPT_BIT, LPC_GPIO_PORT->DIR[KEY_ACCEPT_GPIO]);
+    TEST_ASSERT_BIT_LOW(KEY_CANCEL_BIT, LPC_GPIO_PORT->DIR[KEY_CANCEL_GPIO]);
+    TEST_ASSERT_BIT_HIGH(RGB_RED_BIT, LPC_GPIO_PORT->PIN[RGB_RED_GPIO]);
+    TEST_ASSERT_BIT_HIGH(RGB_GREEN_BIT, LPC_GPIO_PORT->PIN[RGB_GREEN_GPIO]);
+    TEST_ASSERT_BIT_HIGH(RGB_BLUE_BIT, LPC_GPIO_PORT->PIN[RGB_BLUE_GPIO]);
+}
+
+//! @test El temporizador de tiempo usa el RIT con el período pedido y al vencer atiende la función registrada
+void test_tick_timer_uses_rit_and_calls_its_handler(void) {
+    HostClockUseVirtual(IgnoreClock);
+    BoardTickTimerStart(200, CountTicks);
+
+    TEST_ASSERT_EQUAL_UINT32(5 * (SystemCoreClock / 1000), LPC_RITIMER->COMPVAL);
+    TEST_ASSERT_TRUE(host_nvic_enabled & (1ULL << RITIMER_IRQn));
+
+    __WFI();
+    __WFI();
+    TEST_ASSERT_EQUAL_UINT32(2, ticks_counted);
+    TEST_ASSERT_EQUAL_UINT64(10000, HostClockNow());
+    TEST_ASSERT_BIT_LOW(0, LPC_RITIMER->CTRL);
+    Chip_RIT_Disable(LPC_RITIMER);
+}
+
+//! @test El temporizador de tiempo rechaza una frecuencia nula y cuenta el período en ciclos del reloj del RIT
+void test_tick_timer_rejects_zero_and_counts_rit_cycles(void) {
+    HostClockUseVirtual(IgnoreClock);
+    TEST_ASSERT_EQUAL_INT(-1, BoardTickTimerStart(0, CountTicks));
+
+    /* Con milisegundos enteros 3000 interrupciones por segundo daban un período nulo */
+    TEST_ASSERT_EQUAL_INT(0, BoardTickTimerStart(3000, CountTicks));
+    TEST_ASSERT_EQUAL_UINT32(Chip_Clock_GetRate(CLK_MX_RITIMER) / 3000, LPC_RITIMER->COMPVAL);
+    TEST_ASSERT_BITS_HIGH(RIT_CTRL_ENCLR | RIT_CTRL_TEN, LPC_RITIMER->CTRL);
+
+    __WFI();
+    TEST_ASSERT_EQUAL_UINT32(1, ticks_counted);
+    Chip_RIT_Disable(LPC_RITIMER);
+}
+
+//! @test El temporizador de barrido usa la frecuencia que pide la pantalla y se detiene con la pantalla en blanco
+void test_scan_timer_follows_screen_rate(void) {
+    board_t board = BoardCreate();
+    uint8_t value[] = {1, 2, 3, 4};
+
+    HostClockUseVirtual(IgnoreClock);
+    BoardScanTimerStart(CountTicks);
+    TEST_ASSERT_BITS_LOW(SysTick_CTRL_ENABLE_Msk, SysTick->CTRL);
+
+    ScreenWriteBCD(board->screen, value, sizeof(value));
+    TEST_ASSERT_BITS_HIGH(SysTick_CTRL_ENABLE_Msk, SysTick->CTRL);
+    TEST_ASSERT_EQUAL_UINT32(SystemCoreClock / ScreenGetRefreshRate(board->screen), SysTick->LOAD + 1);
+    __WFI();
+    TEST_ASSERT_EQUAL_UINT32(1, ticks_counted);
+
+    ScreenWriteText(board->screen, "");
+    TEST_ASSERT_BITS_LOW(SysTick_CTRL_ENABLE_Msk, SysTick->CTRL);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -39,6 +39,7 @@ SPDX-License-Identifier: MIT
  * -Hacer sonar la alarma y cancelarla hasta el otro dia.
  * -Probar getTime con NULL como argumento.
  * -Hacer una prueba con frecuencias diferentes.
+ * -Cada tick indica si completó un segundo.
  */
 /* === Macros definitions ========================================================================================== */
 
@@ -279,7 +280,7 @@ void test_clock_ring_and_cancel_alarm_today(void) {
     SimulateSeconds(clock, 15); // ahora son 10:00:00
     TEST_ASSERT_TRUE(ClockIsAlarmActive(clock));
 
-    ClockCancelAlarmToday(clock);
+    ClockPostponeAlarmToNextDay(clock);
     TEST_ASSERT_FALSE(ClockIsAlarmActive(clock));
     //SimulateSeconds(clock, 3600);
     TEST_ASSERT_FALSE(ClockIsAlarmActive(clock));
@@ -287,7 +288,7 @@ void test_clock_ring_and_cancel_alarm_today(void) {
     ClockSetTime(clock, &(clock_time_t){
         .time = {.hours = {9, 0}, .minutes = {9, 5}, .seconds = {5, 4}} // 09:59:45
     });
-    ClockCancelAlarmToday(clock);
+    ClockPostponeAlarmToNextDay(clock);
     ClockSetTime(clock, &(clock_time_t){
         .time = {.hours = {3, 2}, .minutes = {9, 5}, .seconds = {9, 5}}
     });
@@ -327,6 +328,15 @@ void test_clock_with_different_tick_frequency(void) {
     TEST_ASSERT_TIME(0, 0, 0, 0, 0, 1, current_time);
 }
 
+//Cada tick indica si completó un segundo.
+void test_clock_tick_reports_new_second(void) {
+    for (int i = 1; i < CLOCK_TICKS_PER_SECOND; i++) {
+        TEST_ASSERT_FALSE(ClockNewTick(clock));
+    }
+    TEST_ASSERT_TRUE(ClockNewTick(clock));
+    TEST_ASSERT_FALSE(ClockNewTick(clock));
+}
+
 //Rechaza alarmas con horarios fuera del rango válido (como 99:99:99).
 void test_set_alarm_with_invalid_time_should_fail(void) {
     static const clock_time_t invalid_alarm = {.bcd = {9, 9, 9, 9, 9, 9}};
@@ -0,0 +1,308 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_digital.c
+ ** @brief Pruebas unitarias del módulo de entradas y salidas digitales usando el modelo de GPIO de la PC.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "digital.h"
+#include "chip.h"
+#include "unity.h"
+
+/**
+ * -Una entrada individual detecta la activación y la desactivación.
+ * -Las entradas de un grupo no cambian hasta que se lee el grupo.
+ * -Un grupo detecta los flancos de varias entradas en una sola lectura.
+ * -Los flancos de un grupo quedan pendientes hasta que se consultan.
+ * -Un grupo aplica la inversión de cada entrada.
+ * -Un grupo lee entradas de puertos distintos.
+ * -Una entrada de un grupo cambia recién después de leer el mismo nivel las veces necesarias, y la lectura lo informa.
+ * -Los rebotes de una entrada de un grupo no generan flancos.
+ * -Los dos flancos de una entrada de un grupo entre consultas se informan en el orden en que ocurrieron.
+ * -Una salida se activa, se desactiva y cambia de estado.
+ * -Una salida no escribe el puerto si el estado pedido es el actual.
+ * -Un grupo de salidas escribe los cambios de un puerto en una sola actualización.
+ * -Un grupo de salidas no escribe los puertos sin cambios.
+ */
+
+/* === Macros definitions ========================================================================================== */
+
+#define KEYS_GPIO 5 //!< Puerto de las teclas del poncho
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Lee el grupo las veces necesarias para que un nivel estable atraviese el filtro
+ *
+ * @param group Grupo de entradas a leer
+ */
+static void ScanUntilStable(digital_input_group_t group);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void ScanUntilStable(digital_input_group_t group) {
+    for (int index = 0; index < DIGITAL_DEBOUNCE_SAMPLES; index++) {
+        DigitalInputGroupScan(group);
+    }
+}
+
+/**
+ * @brief Setup que se ejecuta antes de cada test. Vuelve los puertos al estado de reset.
+ */
+void setUp(void) {
+    HostGpioReset();
+}
+
+/* === Public function implementation ============================================================================== */
+
+// Una entrada individual detecta la activación y la desactivación.
+void test_single_input_detects_edges(void) {
+    digital_input_t input = DigitalInputCreate(KEYS_GPIO, 8, false);
+
+    TEST_ASSERT_FALSE(DigitalInputGetIsActive(input));
+    HostGpioSetInput(KEYS_GPIO, 8, true);
+    TEST_ASSERT_TRUE(DigitalInputWasActivated(input));
+    TEST_ASSERT_FALSE(DigitalInputWasActivated(input));
+    HostGpioSetInput(KEYS_GPIO, 8, false);
+    TEST_ASSERT_TRUE(DigitalInputWasDeactivated(input));
+}
+
+// Las entradas de un grupo no cambian hasta que se lee el grupo.
+void test_group_input_changes_only_after_scan(void) {
+    digital_input_group_t group = DigitalInputGroupCreate();
+    digital_input_t input = DigitalInputGroupAdd(group, KEYS_GPIO, 12, false);
+
+    HostGpioSetInput(KEYS_GPIO, 12, true);
+    TEST_ASSERT_FALSE(DigitalInputGetIsActive(input));
+    TEST_ASSERT_FALSE(DigitalInputGroupWasChanged(group));
+
+    ScanUntilStable(group);
+    TEST_ASSERT_TRUE(DigitalInputGetIsActive(input));
+    TEST_ASSERT_TRUE(DigitalInputGroupWasChanged(group));
+}
+
+// Un grupo detecta los flancos de varias entradas en una sola lectura.
+void test_group_detects_edges_of_several_inputs(void) {
+    digital_input_group_t group = DigitalInputGroupCreate();
+    digital_input_t first = DigitalInputGroupAdd(group, KEYS_GPIO, 12, false);
+    digital_input_t second = DigitalInputGroupAdd(group, KEYS_GPIO, 13, false);
+    digital_input_t third = DigitalInputGroupAdd(group, KEYS_GPIO, 14, false);
+
+    HostGpioSetInput(KEYS_GPIO, 14, true);
+    ScanUntilStable(group);
+    HostGpioSetInput(KEYS_GPIO, 12, true);
+    HostGpioSetInput(KEYS_GPIO, 14, false);
+    ScanUntilStable(group);
+
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_WAS_ACTIVATED, DigitalInputWasChanged(first));
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_NO_CHANGE, DigitalInputWasChanged(second));
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_WAS_ACTIVATED, DigitalInputWasChanged(third));
+    TEST_ASSERT_FALSE(DigitalInputGetIsActive(third));
+}
+
+// Los flancos de un grupo quedan pendientes hasta que se consultan.
+void test_group_edges_are_latched_until_consumed(void) {
+    digital_input_group_t group = DigitalInputGroupCreate();
+    digital_input_t input = DigitalInputGroupAdd(group, KEYS_GPIO, 15, false);
+
+    HostGpioSetInput(KEYS_GPIO, 15, true);
+    ScanUntilStable(group);
+    HostGpioSetInput(KEYS_GPIO, 15, false);
+    ScanUntilStable(group);
+    ScanUntilStable(group);
+
+    TEST_ASSERT_TRUE(DigitalInputWasDeactivated(input));
+    TEST_ASSERT_FALSE(DigitalInputWasDeactivated(input));
+    TEST_ASSERT_TRUE(DigitalInputGroupWasChanged(group));
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_WAS_ACTIVATED, DigitalInputWasChanged(input));
+    TEST_ASSERT_FALSE(DigitalInputGroupWasChanged(group));
+}
+
+// Un grupo aplica la inversión de cada entrada.
+void test_group_applies_inversion(void) {
+    digital_input_group_t group = DigitalInputGroupCreate();
+    digital_input_t input = DigitalInputGroupAdd(group, KEYS_GPIO, 9, true);
+
+    TEST_ASSERT_TRUE(DigitalInputGetIsActive(input));
+    HostGpioSetInput(KEYS_GPIO, 9, true);
+    ScanUntilStable(group);
+    TEST_ASSERT_TRUE(DigitalInputWasDeactivated(input));
+}
+
+// Un grupo lee entradas de puertos distintos.
+void test_group_reads_inputs_in_different_ports(void) {
+    digital_input_group_t group = DigitalInputGroupCreate();
+    digital_input_t key = DigitalInputGroupAdd(group, KEYS_GPIO, 8, false);
+    digital_input_t other = DigitalInputGroupAdd(group, 0, 4, false);
+
+    TEST_ASSERT_NOT_NULL(key);
+    TEST_ASSERT_NOT_NULL(other);
+    HostGpioSetInput(0, 4, true);
+    ScanUntilStable(group);
+    TEST_ASSERT_FALSE(DigitalInputWasActivated(key));
+    TEST_ASSERT_TRUE(DigitalInputWasActivated(other));
+}
+
+// Una entrada de un grupo cambia recién después de leer el mismo nivel las veces necesarias, y la lectura lo informa.
+void test_group_input_changes_after_debounce_samples(void) {
+    digital_input_group_t group = DigitalInputGroupCreate();
+    digital_input_t input = DigitalInputGroupAdd(group, KEYS_GPIO, 10, false);
+
+    HostGpioSetInput(KEYS_GPIO, 10, true);
+    for (int index = 1; index < DIGITAL_DEBOUNCE_SAMPLES; index++) {
+        TEST_ASSERT_FALSE(DigitalInputGroupScan(group));
+        TEST_ASSERT_FALSE(DigitalInputGetIsActive(input));
+    }
+    TEST_ASSERT_TRUE(DigitalInputGroupScan(group));
+    TEST_ASSERT_FALSE(DigitalInputGroupScan(group));
+    TEST_ASSERT_TRUE(DigitalInputGetIsActive(input));
+    TEST_ASSERT_TRUE(DigitalInputWasActivated(input));
+}
+
+// Los rebotes de una entrada de un grupo no generan flancos.
+void test_group_ignores_bounces(void) {
+    digital_input_group_t group = DigitalInputGroupCreate();
+    digital_input_t input = DigitalInputGroupAdd(group, KEYS_GPIO, 10, false);
+
+    for (int index = 0; index < 10; index++) {
+        HostGpioSetInput(KEYS_GPIO, 10, true);
+        DigitalInputGroupScan(group);
+        DigitalInputGroupScan(group);
+        HostGpioSetInput(KEYS_GPIO, 10, false);
+        DigitalInputGroupScan(group);
+    }
+    TEST_ASSERT_FALSE(DigitalInputGetIsActive(input));
+    TEST_ASSERT_FALSE(DigitalInputGroupWasChanged(group));
+
+    HostGpioSetInput(KEYS_GPIO, 10, true);
+    ScanUntilStable(group);
+    TEST_ASSERT_TRUE(DigitalInputWasActivated(input));
+}
+
+// Los dos flancos de una entrada de un grupo entre consultas se informan en el orden en que ocurrieron.
+void test_group_reports_both_edges_in_order(void) {
+    digital_input_group_t group = DigitalInputGroupCreate();
+    digital_input_t input = DigitalInputGroupAdd(group, KEYS_GPIO, 11, false);
+
+    HostGpioSetInput(KEYS_GPIO, 11, true);
+    ScanUntilStable(group);
+    HostGpioSetInput(KEYS_GPIO, 11, false);
+    ScanUntilStable(group);
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_WAS_ACTIVATED, DigitalInputWasChanged(input));
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_WAS_DEACTIVATED, DigitalInputWasChanged(input));
+
+    HostGpioSetInput(KEYS_GPIO, 11, true);
+    ScanUntilStable(group);
+    DigitalInputWasChanged(input);
+    HostGpioSetInput(KEYS_GPIO, 11, false);
+    ScanUntilStable(group);
+    HostGpioSetInput(KEYS_GPIO, 11, true);
+    ScanUntilStable(group);
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_WAS_DEACTIVATED, DigitalInputWasChanged(input));
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_WAS_ACTIVATED, DigitalInputWasChanged(input));
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_NO_CHANGE, DigitalInputWasChanged(input));
+}
+
+// Una salida se activa, se desactiva y cambia de estado.
+void test_output_activate_deactivate_and_toggle(void) {
+    digital_output_t output = DigitalOutputCreate(0, 11, false);
+
+    TEST_ASSERT_TRUE(LPC_GPIO_PORT->DIR[0] & (1 << 11));
+    DigitalOutputActivate(output);
+    TEST_ASSERT_TRUE(LPC_GPIO_PORT->PIN[0] & (1 << 11));
+    DigitalOutputDeactivate(output);
+    TEST_ASSERT_FALSE(LPC_GPIO_PORT->PIN[0] & (1 << 11));
+    DigitalOutputToggle(output);
+    TEST_ASSERT_TRUE(LPC_GPIO_PORT->PIN[0] & (1 << 11));
+}
+
+// Una salida no escribe el puerto si el estado pedido es el actual.
+void test_output_skips_redundant_writes(void) {
+    digital_output_t output = DigitalOutputCreate(0, 11, true);
+    digital_output_stats_t stats;
+    uint32_t writes = LPC_GPIO_PORT->WRITES;
+
+    for (int index = 0; index < 10; index++) {
+        DigitalOutputActivate(output);
+    }
+    DigitalOutputDeactivate(output);
+    DigitalOutputDeactivate(output);
+
+    DigitalOutputGetStats(output, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.performed);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.skipped);
+    TEST_ASSERT_EQUAL_UINT32(writes + 2, LPC_GPIO_PORT->WRITES);
+    TEST_ASSERT_TRUE(LPC_GPIO_PORT->PIN[0] & (1 << 11));
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(output));
+}
+
+// Un grupo de salidas escribe los cambios de un puerto en una sola actualización.
+void test_output_group_writes_port_once(void) {
+    digital_output_group_t group = DigitalOutputGroupCreate();
+    digital_output_t red = DigitalOutputGroupAdd(group, 0, 11, true);
+    digital_output_t blue = DigitalOutputGroupAdd(group, 0, 10, false);
+    digital_output_t green = DigitalOutputGroupAdd(group, 1, 8, true);
+    digital_output_stats_t stats;
+    uint32_t writes = LPC_GPIO_PORT->WRITES;
+
+    DigitalOutputActivate(red);
+    DigitalOutputActivate(blue);
+    TEST_ASSERT_EQUAL_UINT32(writes, LPC_GPIO_PORT->WRITES);
+    TEST_ASSERT_TRUE(LPC_GPIO_PORT->PIN[0] & (1 << 11));
+
+    DigitalOutputGroupUpdate(group);
+    TEST_ASSERT_EQUAL_UINT32(writes + 2, LPC_GPIO_PORT->WRITES);
+    TEST_ASSERT_FALSE(LPC_GPIO_PORT->PIN[0] & (1 << 11));
+    TEST_ASSERT_TRUE(LPC_GPIO_PORT->PIN[0] & (1 << 10));
+    TEST_ASSERT_TRUE(LPC_GPIO_PORT->PIN[1] & (1 << 8));
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(green));
+
+    DigitalOutputGroupGetStats(group, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.performed);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.skipped);
+}
+
+// Un grupo de salidas no escribe los puertos sin cambios.
+void test_output_group_skips_unchanged_ports(void) {
+    digital_output_group_t group = DigitalOutputGroupCreate();
+    digital_output_t red = DigitalOutputGroupAdd(group, 0, 11, true);
+    digital_output_stats_t stats;
+    uint32_t writes;
+
+    DigitalOutputToggle(red);
+    DigitalOutputToggle(red);
+    writes = LPC_GPIO_PORT->WRITES;
+    DigitalOutputGroupUpdate(group);
+    DigitalOutputGroupUpdate(group);
+
+    TEST_ASSERT_EQUAL_UINT32(writes, LPC_GPIO_PORT->WRITES);
+    DigitalOutputGroupGetStats(group, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.performed);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.skipped);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,242 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_digital_events.c
+ ** @brief Pruebas de los flancos detectados por interrupción y medición de su latencia en la PC
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "digital.h"
+#include "chip.h"
+#include "unity.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+
+/**
+ * -Un flanco de una entrada con eventos habilitados se guarda con su marca de tiempo.
+ * -Cada flanco guardado se avisa desde la interrupción.
+ * -Los flancos de una entrada invertida respetan la inversión.
+ * -Una entrada sin eventos habilitados no genera flancos.
+ * -No se puede usar un canal inválido ni uno ya asignado.
+ * -Los flancos de una entrada de un grupo se informan sin esperar a leer el grupo.
+ * -El programa principal dormido en __WFI despierta con cada flanco y se mide la latencia.
+ */
+
+/* === Macros definitions ========================================================================================== */
+
+#define KEY_GPIO 5          //!< Puerto de la tecla usada en las pruebas
+#define KEY_BIT  8          //!< Bit de la tecla usada en las pruebas
+#define LATENCY_EDGES 200   //!< Cantidad de flancos generados para medir la latencia
+#define LATENCY_MAX_US 50000 //!< Latencia máxima aceptada en la PC, holgada para equipos cargados (us)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Marca de tiempo de las pruebas, un contador que avanza en cada llamada
+ */
+static uint32_t CountingTimestamp(void);
+
+/**
+ * @brief Marca de tiempo del reloj monotónico de la PC en microsegundos
+ */
+static uint32_t MonotonicTimestamp(void);
+
+/**
+ * @brief Cuenta los avisos de flancos guardados
+ */
+static void CountNotify(void);
+
+/**
+ * @brief Hilo que genera flancos en la tecla, como lo haría una persona, guardando el instante de cada uno
+ */
+static void * Stimulus(void * arguments);
+
+/* === Private variable definitions ================================================================================ */
+
+static uint32_t counter;
+
+//! Cantidad de avisos de flancos recibidos
+static uint32_t notified;
+
+//! Instante en que el estímulo generó cada flanco (us)
+static volatile uint32_t edge_time[LATENCY_EDGES];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t CountingTimestamp(void) {
+    return ++counter;
+}
+
+static void CountNotify(void) {
+    notified++;
+}
+
+static uint32_t MonotonicTimestamp(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000UL + now.tv_nsec / 1000);
+}
+
+static void * Stimulus(void * arguments) {
+    struct timespec pause = {.tv_sec = 0, .tv_nsec = 200000};
+
+    (void)arguments;
+    for (int index = 0; index < LATENCY_EDGES; index++) {
+        nanosleep(&pause, NULL);
+        edge_time[index] = MonotonicTimestamp();
+        HostGpioSetInput(KEY_GPIO, KEY_BIT, (index % 2) == 0);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Setup que se ejecuta antes de cada test
+ */
+void setUp(void) {
+    HostGpioReset();
+    counter = 0;
+    notified = 0;
+    DigitalEventsInit(CountingTimestamp, NULL);
+}
+
+/* === Public function implementation ============================================================================== */
+
+// Un flanco de una entrada con eventos habilitados se guarda con su marca de tiempo.
+void test_edge_is_queued_with_timestamp(void) {
+    digital_input_t input = DigitalInputCreate(KEY_GPIO, KEY_BIT, false);
+    digital_event_t event;
+
+    TEST_ASSERT_EQUAL_INT(0, DigitalInputEnableEvents(input, 0));
+    HostGpioSetInput(KEY_GPIO, KEY_BIT, true);
+    HostGpioSetInput(KEY_GPIO, KEY_BIT, false);
+
+    TEST_ASSERT_TRUE(DigitalEventGet(&event));
+    TEST_ASSERT_EQUAL_PTR(input, event.input);
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_WAS_ACTIVATED, event.edge);
+    TEST_ASSERT_EQUAL_UINT32(1, event.timestamp);
+    TEST_ASSERT_TRUE(DigitalEventGet(&event));
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_WAS_DEACTIVATED, event.edge);
+    TEST_ASSERT_EQUAL_UINT32(2, event.timestamp);
+    TEST_ASSERT_FALSE(DigitalEventsPending());
+}
+
+// Cada flanco guardado se avisa desde la interrupción.
+void test_each_edge_is_notified(void) {
+    digital_input_t input = DigitalInputCreate(KEY_GPIO, KEY_BIT, false);
+
+    DigitalEventsInit(CountingTimestamp, CountNotify);
+    DigitalInputEnableEvents(input, 0);
+    HostGpioSetInput(KEY_GPIO, KEY_BIT, true);
+    HostGpioSetInput(KEY_GPIO, KEY_BIT, false);
+    TEST_ASSERT_EQUAL_UINT32(2, notified);
+}
+
+// Los flancos de una entrada invertida respetan la inversión.
+void test_inverted_input_edges(void) {
+    digital_input_t input = DigitalInputCreate(KEY_GPIO, KEY_BIT, true);
+    digital_event_t event;
+
+    DigitalInputEnableEvents(input, 3);
+    HostGpioSetInput(KEY_GPIO, KEY_BIT, true);
+    TEST_ASSERT_TRUE(DigitalEventGet(&event));
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_WAS_DEACTIVATED, event.edge);
+}
+
+// Una entrada sin eventos habilitados no genera flancos.
+void test_input_without_events_does_not_queue(void) {
+    DigitalInputCreate(KEY_GPIO, KEY_BIT, false);
+    HostGpioSetInput(KEY_GPIO, KEY_BIT, true);
+    TEST_ASSERT_FALSE(DigitalEventsPending());
+}
+
+// No se puede usar un canal inválido ni uno ya asignado.
+void test_invalid_or_used_channel_fails(void) {
+    digital_input_t first = DigitalInputCreate(KEY_GPIO, KEY_BIT, false);
+    digital_input_t second = DigitalInputCreate(KEY_GPIO, KEY_BIT + 1, false);
+
+    TEST_ASSERT_EQUAL_INT(-1, DigitalInputEnableEvents(first, DIGITAL_EVENTS_CHANNELS));
+    TEST_ASSERT_EQUAL_INT(0, DigitalInputEnableEvents(first, 1));
+    TEST_ASSERT_EQUAL_INT(-1, DigitalInputEnableEvents(second, 1));
+}
+
+// Los flancos de una entrada de un grupo se informan sin esperar a leer el grupo.
+void test_group_input_edges_do_not_wait_for_scan(void) {
+    digital_input_group_t group = DigitalInputGroupCreate();
+    digital_input_t input = DigitalInputGroupAdd(group, KEY_GPIO, KEY_BIT, false);
+    digital_event_t event;
+
+    DigitalInputEnableEvents(input, 2);
+    HostGpioSetInput(KEY_GPIO, KEY_BIT, true);
+    TEST_ASSERT_TRUE(DigitalEventGet(&event));
+    TEST_ASSERT_EQUAL_INT(DIGITAL_INPUT_WAS_ACTIVATED, event.edge);
+    TEST_ASSERT_FALSE(DigitalInputGetIsActive(input));
+}
+
+// El programa principal dormido en __WFI despierta con cada flanco y se mide la latencia.
+void test_sleeping_main_loop_wakes_on_edges(void) {
+    digital_input_t input = DigitalInputCreate(KEY_GPIO, KEY_BIT, false);
+    digital_event_t event;
+    pthread_t stimulus;
+    uint64_t handler_total = 0, wakeup_total = 0;
+    uint32_t handler_max = 0, wakeup_max = 0;
+    char message[128];
+
+    DigitalEventsInit(MonotonicTimestamp, NULL);
+    DigitalInputEnableEvents(input, 0);
+    pthread_create(&stimulus, NULL, Stimulus, NULL);
+
+    for (int index = 0; index < LATENCY_EDGES; index++) {
+        /* Misma secuencia que el programa principal: comprobar y dormir sin perder interrupciones */
+        __disable_irq();
+        while (!DigitalEventsPending()) {
+            __WFI();
+        }
+        __enable_irq();
+
+        uint32_t now = MonotonicTimestamp();
+        TEST_ASSERT_TRUE(DigitalEventGet(&event));
+        TEST_ASSERT_EQUAL_INT((index % 2) == 0 ? DIGITAL_INPUT_WAS_ACTIVATED : DIGITAL_INPUT_WAS_DEACTIVATED,
+                              event.edge);
+
+        uint32_t handler = event.timestamp - edge_time[index];
+        uint32_t wakeup = now - edge_time[index];
+        handler_total += handler;
+        wakeup_total += wakeup;
+        handler_max = (handler > handler_max) ? handler : handler_max;
+        wakeup_max = (wakeup > wakeup_max) ? wakeup : wakeup_max;
+    }
+    pthread_join(stimulus, NULL);
+
+    snprintf(message, sizeof(message), "flanco a manejador: media %lu us, max %u us; a despertar: media %lu us, max %u us",
+             (unsigned long)(handler_total / LATENCY_EDGES), (unsigned)handler_max,
+             (unsigned long)(wakeup_total / LATENCY_EDGES), (unsigned)wakeup_max);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(wakeup_max < LATENCY_MAX_US);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,225 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_fsm.c
+ ** @brief Pruebas unitarias de la máquina de estados dirigida por una tabla
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "fsm.h"
+#include "unity.h"
+#include <string.h>
+
+/**
+ * -Al crear la máquina se ejecuta la entrada del estado inicial.
+ * -Un evento con transición sale del estado actual y entra al siguiente.
+ * -Los eventos sin transición en el estado actual se ignoran.
+ * -Una transición interna ejecuta la acción sin salir del estado.
+ * -Una transición al mismo estado sale y vuelve a entrar.
+ * -La acción puede elegir un estado distinto al de la tabla.
+ * -No se crea una máquina con el estado reservado como inicial.
+ */
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estados de la máquina de prueba, el cero está reservado
+typedef enum {
+    STATE_IDLE = 1,
+    STATE_RUN,
+    STATE_ERROR,
+    STATES_COUNT,
+} test_state_t;
+
+//! Eventos de la máquina de prueba
+typedef enum {
+    EVENT_START,
+    EVENT_COUNT,
+    EVENT_CHECK,
+    EVENT_RESTART,
+    EVENT_UNUSED,
+    EVENTS_COUNT,
+} test_event_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Registra las entradas y salidas de los estados en el contexto
+ */
+static void EnterIdle(void * context);
+static void ExitIdle(void * context);
+static void EnterRun(void * context);
+static void ExitRun(void * context);
+static void EnterError(void * context);
+
+/**
+ * @brief Acción que registra su ejecución y deja el estado de la tabla
+ */
+static uint8_t Count(void * context, uint8_t next);
+
+/**
+ * @brief Acción que rechaza la transición de la tabla y pasa al estado de error
+ */
+static uint8_t Check(void * context, uint8_t next);
+
+/* === Private variable definitions ================================================================================ */
+
+static const fsm_state_t STATES[STATES_COUNT] = {
+    [STATE_IDLE] = {.entry = EnterIdle, .exit = ExitIdle},
+    [STATE_RUN] = {.entry = EnterRun, .exit = ExitRun},
+    [STATE_ERROR] = {.entry = EnterError},
+};
+
+static const fsm_transition_t TRANSITIONS[STATES_COUNT][EVENTS_COUNT] = {
+    [STATE_IDLE] = {
+        [EVENT_START] = {NULL, STATE_RUN},
+        [EVENT_COUNT] = {Count, FSM_STAY},
+        [EVENT_CHECK] = {Check, STATE_RUN},
+        [EVENT_RESTART] = {NULL, STATE_IDLE},
+    },
+    [STATE_RUN] = {
+        [EVENT_START] = {NULL, STATE_IDLE},
+    },
+};
+
+static const struct fsm_table_s TABLE = {
+    .states = STATES,
+    .transitions = &TRANSITIONS[0][0],
+    .states_count = STATES_COUNT,
+    .events_count = EVENTS_COUNT,
+};
+
+//! Registro de las entradas, salidas y acciones ejecutadas
+static char trace[32];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void EnterIdle(void * context) {
+    strcat(context, "+I");
+}
+
+static void ExitIdle(void * context) {
+    strcat(context, "-I");
+}
+
+static void EnterRun(void * context) {
+    strcat(context, "+R");
+}
+
+static void ExitRun(void * context) {
+    strcat(context, "-R");
+}
+
+static void EnterError(void * context) {
+    strcat(context, "+E");
+}
+
+static uint8_t Count(void * context, uint8_t next) {
+    strcat(context, "C");
+    return next;
+}
+
+static uint8_t Check(void * context, uint8_t next) {
+    (void)next;
+    strcat(context, "K");
+    return STATE_ERROR;
+}
+
+/**
+ * @brief Setup que se ejecuta antes de cada test
+ */
+void setUp(void) {
+    trace[0] = '\0';
+}
+
+/* === Public function implementation ============================================================================== */
+
+// Al crear la máquina se ejecuta la entrada del estado inicial.
+void test_create_enters_initial_state(void) {
+    fsm_t fsm = FsmCreate(&TABLE, STATE_IDLE, trace);
+
+    TEST_ASSERT_NOT_NULL(fsm);
+    TEST_ASSERT_EQUAL_UINT8(STATE_IDLE, FsmGetState(fsm));
+    TEST_ASSERT_EQUAL_STRING("+I", trace);
+}
+
+// Un evento con transición sale del estado actual y entra al siguiente.
+void test_transition_exits_and_enters(void) {
+    fsm_t fsm = FsmCreate(&TABLE, STATE_IDLE, trace);
+
+    FsmDispatch(fsm, EVENT_START);
+    TEST_ASSERT_EQUAL_UINT8(STATE_RUN, FsmGetState(fsm));
+    FsmDispatch(fsm, EVENT_START);
+    TEST_ASSERT_EQUAL_UINT8(STATE_IDLE, FsmGetState(fsm));
+    TEST_ASSERT_EQUAL_STRING("+I-I+R-R+I", trace);
+}
+
+// Los eventos sin transición en el estado actual se ignoran.
+void test_unhandled_events_are_ignored(void) {
+    fsm_t fsm = FsmCreate(&TABLE, STATE_IDLE, trace);
+
+    FsmDispatch(fsm, EVENT_START);
+    FsmDispatch(fsm, EVENT_COUNT);
+    FsmDispatch(fsm, EVENT_UNUSED);
+    FsmDispatch(fsm, EVENTS_COUNT);
+    TEST_ASSERT_EQUAL_UINT8(STATE_RUN, FsmGetState(fsm));
+    TEST_ASSERT_EQUAL_STRING("+I-I+R", trace);
+}
+
+// Una transición interna ejecuta la acción sin salir del estado.
+void test_internal_transition_runs_action_only(void) {
+    fsm_t fsm = FsmCreate(&TABLE, STATE_IDLE, trace);
+
+    FsmDispatch(fsm, EVENT_COUNT);
+    FsmDispatch(fsm, EVENT_COUNT);
+    TEST_ASSERT_EQUAL_UINT8(STATE_IDLE, FsmGetState(fsm));
+    TEST_ASSERT_EQUAL_STRING("+ICC", trace);
+}
+
+// Una transición al mismo estado sale y vuelve a entrar.
+void test_self_transition_reenters_state(void) {
+    fsm_t fsm = FsmCreate(&TABLE, STATE_IDLE, trace);
+
+    FsmDispatch(fsm, EVENT_RESTART);
+    TEST_ASSERT_EQUAL_UINT8(STATE_IDLE, FsmGetState(fsm));
+    TEST_ASSERT_EQUAL_STRING("+I-I+I", trace);
+}
+
+// La acción puede elegir un estado distinto al de la tabla.
+void test_action_chooses_next_state(void) {
+    fsm_t fsm = FsmCreate(&TABLE, STATE_IDLE, trace);
+
+    FsmDispatch(fsm, EVENT_CHECK);
+    TEST_ASSERT_EQUAL_UINT8(STATE_ERROR, FsmGetState(fsm));
+    TEST_ASSERT_EQUAL_STRING("+IK-I+E", trace);
+}
+
+// No se crea una máquina con el estado reservado como inicial.
+void test_create_rejects_reserved_state(void) {
+    TEST_ASSERT_NULL(FsmCreate(&TABLE, FSM_STAY, trace));
+    TEST_ASSERT_NULL(FsmCreate(&TABLE, STATES_COUNT, trace));
+    TEST_ASSERT_EQUAL_STRING("", trace);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,200 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_gesture.c
+ ** @brief Pruebas unitarias del módulo que reconoce gestos sobre una tecla
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "gesture.h"
+#include "digital.h"
+#include "chip.h"
+#include "unity.h"
+
+/**
+ * -Una presión corta genera un clic al soltar la tecla, que queda pendiente hasta consultarlo.
+ * -Dos presiones cortas seguidas generan un doble clic.
+ * -Con el doble clic habilitado el clic se informa al vencer la espera.
+ * -Mantener la tecla genera una presión larga y no genera clic al soltarla.
+ * -Mantener la tecla genera repeticiones cada vez más rápidas hasta el intervalo mínimo.
+ * -Una presión de más de 65 segundos sigue repitiendo al intervalo mínimo.
+ * -Un clic pendiente seguido de una presión larga se informa como clic.
+ * -Una tecla presionada al crear el reconocedor no genera gestos.
+ */
+
+/* === Macros definitions ========================================================================================== */
+
+#define KEY_GPIO 5 //!< Puerto de la tecla usada en las pruebas
+#define KEY_BIT  8 //!< Bit de la tecla usada en las pruebas
+#define TICK_MS  5 //!< Intervalo entre avances del reconocedor
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Mantiene la tecla en un estado durante un tiempo avanzando el reconocedor
+ *
+ * @param pressed Estado de la tecla
+ * @param time_ms Tiempo a simular (ms)
+ */
+static void Hold(bool pressed, uint16_t time_ms);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Configuración con todos los gestos habilitados
+static const struct gesture_config_s CONFIG = {
+    .double_click_ms = 300,
+    .long_press_ms = 1000,
+    .repeat_delay_ms = 0,
+};
+
+//! Configuración de una tecla de ajuste con repetición acelerada
+static const struct gesture_config_s REPEAT_CONFIG = {
+    .repeat_delay_ms = 500,
+    .repeat_period_ms = 200,
+    .repeat_min_ms = 50,
+    .repeat_step_ms = 50,
+};
+
+static gesture_t gesture;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void Hold(bool pressed, uint16_t time_ms) {
+    HostGpioSetInput(KEY_GPIO, KEY_BIT, pressed);
+    for (uint16_t elapsed = 0; elapsed < time_ms; elapsed += TICK_MS) {
+        GestureTick(gesture, TICK_MS);
+    }
+}
+
+/**
+ * @brief Setup que se ejecuta antes de cada test
+ */
+void setUp(void) {
+    HostGpioReset();
+    gesture = GestureCreate(DigitalInputCreate(KEY_GPIO, KEY_BIT, false), &CONFIG);
+}
+
+/* === Public function implementation ============================================================================== */
+
+// Una presión corta genera un clic al soltar la tecla, que queda pendiente hasta consultarlo.
+void test_short_press_generates_click(void) {
+    static const struct gesture_config_s config = {0};
+    gesture = GestureCreate(DigitalInputCreate(KEY_GPIO, KEY_BIT, false), &config);
+
+    Hold(true, 100);
+    TEST_ASSERT_FALSE(GestureHasEvent(gesture));
+    TEST_ASSERT_EQUAL_INT(GESTURE_NONE, GestureGetEvent(gesture));
+    Hold(false, TICK_MS);
+    TEST_ASSERT_TRUE(GestureHasEvent(gesture));
+    TEST_ASSERT_EQUAL_INT(GESTURE_CLICK, GestureGetEvent(gesture));
+    TEST_ASSERT_FALSE(GestureHasEvent(gesture));
+    TEST_ASSERT_EQUAL_INT(GESTURE_NONE, GestureGetEvent(gesture));
+}
+
+// Dos presiones cortas seguidas generan un doble clic.
+void test_two_short_presses_generate_double_click(void) {
+    Hold(true, 100);
+    Hold(false, 100);
+    Hold(true, 100);
+    Hold(false, 500);
+    TEST_ASSERT_EQUAL_INT(GESTURE_DOUBLE_CLICK, GestureGetEvent(gesture));
+    TEST_ASSERT_EQUAL_INT(GESTURE_NONE, GestureGetEvent(gesture));
+}
+
+// Con el doble clic habilitado el clic se informa al vencer la espera.
+void test_click_waits_for_double_click_timeout(void) {
+    Hold(true, 100);
+    Hold(false, 250);
+    TEST_ASSERT_EQUAL_INT(GESTURE_NONE, GestureGetEvent(gesture));
+    Hold(false, 100);
+    TEST_ASSERT_EQUAL_INT(GESTURE_CLICK, GestureGetEvent(gesture));
+}
+
+// Mantener la tecla genera una presión larga y no genera clic al soltarla.
+void test_hold_generates_long_press_without_click(void) {
+    Hold(true, 950);
+    TEST_ASSERT_EQUAL_INT(GESTURE_NONE, GestureGetEvent(gesture));
+    Hold(true, 2000);
+    TEST_ASSERT_EQUAL_INT(GESTURE_LONG_PRESS, GestureGetEvent(gesture));
+    Hold(false, 500);
+    TEST_ASSERT_EQUAL_INT(GESTURE_NONE, GestureGetEvent(gesture));
+}
+
+// Mantener la tecla genera repeticiones cada vez más rápidas hasta el intervalo mínimo.
+void test_hold_generates_accelerating_repeats(void) {
+    static const uint16_t expected[] = {500, 700, 850, 950, 1000, 1050, 1100};
+    uint16_t elapsed = 0;
+    uint8_t count = 0;
+
+    gesture = GestureCreate(DigitalInputCreate(KEY_GPIO, KEY_BIT, false), &REPEAT_CONFIG);
+    HostGpioSetInput(KEY_GPIO, KEY_BIT, true);
+    GestureTick(gesture, TICK_MS);
+    while (count < sizeof(expected) / sizeof(expected[0])) {
+        GestureTick(gesture, TICK_MS);
+        elapsed += TICK_MS;
+        if (GestureGetEvent(gesture) == GESTURE_REPEAT) {
+            TEST_ASSERT_EQUAL_UINT16(expected[count], elapsed);
+            count++;
+        }
+        TEST_ASSERT_TRUE(elapsed <= 2000);
+    }
+    Hold(false, TICK_MS);
+    TEST_ASSERT_EQUAL_INT(GESTURE_NONE, GestureGetEvent(gesture));
+}
+
+// Una presión de más de 65 segundos sigue repitiendo al intervalo mínimo.
+void test_long_hold_keeps_minimum_repeat_period(void) {
+    uint16_t repeats = 0;
+
+    gesture = GestureCreate(DigitalInputCreate(KEY_GPIO, KEY_BIT, false), &REPEAT_CONFIG);
+    HostGpioSetInput(KEY_GPIO, KEY_BIT, true);
+    GestureTick(gesture, TICK_MS);
+    for (uint32_t elapsed = TICK_MS; elapsed <= 70000; elapsed += TICK_MS) {
+        GestureTick(gesture, TICK_MS);
+        if ((GestureGetEvent(gesture) == GESTURE_REPEAT) && (elapsed > 69000)) {
+            repeats++;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT16(1000 / REPEAT_CONFIG.repeat_min_ms, repeats);
+}
+
+// Un clic pendiente seguido de una presión larga se informa como clic.
+void test_pending_click_before_long_press(void) {
+    Hold(true, 100);
+    Hold(false, 100);
+    Hold(true, 1200);
+    TEST_ASSERT_EQUAL_INT(GESTURE_CLICK, GestureGetEvent(gesture));
+    TEST_ASSERT_EQUAL_INT(GESTURE_LONG_PRESS, GestureGetEvent(gesture));
+}
+
+// Una tecla presionada al crear el reconocedor no genera gestos.
+void test_key_pressed_at_creation_is_ignored(void) {
+    HostGpioSetInput(KEY_GPIO, KEY_BIT, true);
+    gesture = GestureCreate(DigitalInputCreate(KEY_GPIO, KEY_BIT, false), &CONFIG);
+    Hold(true, 2000);
+    Hold(false, 500);
+    TEST_ASSERT_EQUAL_INT(GESTURE_NONE, GestureGetEvent(gesture));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,171 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_latency.c
+ ** @brief Pruebas unitarias del módulo que mide la latencia de las teclas
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "latency.h"
+#include "chip.h"
+#include "unity.h"
+
+/**
+ * -Una pulsación que recorre todas las etapas se suma al histograma de la latencia total.
+ * -Las marcas fuera de orden se ignoran.
+ * -Los rebotes no reinician la medición, que se cuenta desde el primer flanco.
+ * -Un evento que no cambia la pantalla se descarta.
+ * -Una medición que demora más que el límite se descarta y el próximo flanco empieza otra.
+ * -Las latencias que superan el histograma se cuentan en la última barra.
+ */
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula la marca de tiempo de un flanco anterior al instante actual
+ *
+ * @param us Microsegundos transcurridos desde el flanco
+ * @return uint32_t Ciclos del núcleo del flanco
+ */
+static uint32_t Ago(uint32_t us);
+
+/**
+ * @brief Marca en orden todas las etapas posteriores al flanco
+ */
+static void CompleteStages(void);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t Ago(uint32_t us) {
+    return LatencyNow() - us * (SystemCoreClock / 1000000UL);
+}
+
+static void CompleteStages(void) {
+    LatencyMark(LATENCY_HANDLED);
+    LatencyMark(LATENCY_PUBLISHED);
+    LatencyMark(LATENCY_SHOWN);
+}
+
+/**
+ * @brief Setup que se ejecuta antes de cada test
+ */
+void setUp(void) {
+    LatencyInit();
+}
+
+/* === Public function implementation ============================================================================== */
+
+// Una pulsación que recorre todas las etapas se suma al histograma de la latencia total.
+void test_complete_measurement_fills_histogram(void) {
+    latency_stats_t stats;
+
+    LatencyEdge(Ago(5 * LATENCY_BUCKET_US));
+    CompleteStages();
+    LatencyGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.discarded);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.histogram[5]);
+    TEST_ASSERT_UINT32_WITHIN(LATENCY_BUCKET_US / 2, 5 * LATENCY_BUCKET_US, stats.max[LATENCY_SHOWN]);
+    TEST_ASSERT_EQUAL_UINT32(stats.max[LATENCY_HANDLED], stats.mean[LATENCY_HANDLED]);
+    TEST_ASSERT_LESS_OR_EQUAL(stats.max[LATENCY_SHOWN], stats.max[LATENCY_PUBLISHED]);
+}
+
+// Las marcas fuera de orden se ignoran.
+void test_out_of_order_marks_are_ignored(void) {
+    latency_stats_t stats;
+
+    LatencyMark(LATENCY_HANDLED);
+    LatencyMark(LATENCY_SHOWN);
+    LatencyEdge(LatencyNow());
+    LatencyMark(LATENCY_PUBLISHED);
+    LatencyMark(LATENCY_SHOWN);
+    LatencyGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.count);
+
+    CompleteStages();
+    LatencyGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.count);
+}
+
+// Los rebotes no reinician la medición, que se cuenta desde el primer flanco.
+void test_bounces_do_not_restart_measurement(void) {
+    latency_stats_t stats;
+
+    LatencyEdge(Ago(4 * LATENCY_BUCKET_US));
+    LatencyEdge(Ago(LATENCY_BUCKET_US));
+    CompleteStages();
+    LatencyGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.histogram[4]);
+}
+
+// Un evento que no cambia la pantalla se descarta.
+void test_unchanged_screen_is_discarded(void) {
+    latency_stats_t stats;
+
+    LatencyEdge(LatencyNow());
+    LatencyMark(LATENCY_HANDLED);
+    LatencySettle();
+    LatencyMark(LATENCY_PUBLISHED);
+    LatencyMark(LATENCY_SHOWN);
+    LatencyGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.discarded);
+}
+
+// Una medición que demora más que el límite se descarta y el próximo flanco empieza otra.
+void test_late_measurement_is_discarded(void) {
+    latency_stats_t stats;
+
+    LatencyEdge(Ago(LATENCY_TIMEOUT_US + LATENCY_BUCKET_US));
+    LatencyEdge(LatencyNow());
+    CompleteStages();
+    LatencyGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.discarded);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.histogram[0]);
+
+    LatencyEdge(Ago(LATENCY_TIMEOUT_US + LATENCY_BUCKET_US));
+    CompleteStages();
+    LatencyGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.discarded);
+}
+
+// Las latencias que superan el histograma se cuentan en la última barra.
+void test_long_latency_counts_in_last_bucket(void) {
+    latency_stats_t stats;
+
+    LatencyEdge(Ago((LATENCY_BUCKETS + 1) * LATENCY_BUCKET_US));
+    CompleteStages();
+    LatencyGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.histogram[LATENCY_BUCKETS - 1]);
+}
+
+/* === End of documentation ======================================================================================== */
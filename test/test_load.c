@@ -0,0 +1,158 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_load.c
+ ** @brief Pruebas unitarias del módulo que mide la carga del procesador
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "load.h"
+#include "chip.h"
+#include "unity.h"
+
+/**
+ * -Un núcleo que nunca duerme tiene la carga completa.
+ * -La carga se calcula una vez por segundo.
+ * -Borrar la carga máxima la vuelve a medir desde cero y decide si entra en el presupuesto.
+ * -Un núcleo que duerme entre las interrupciones tiene poca carga.
+ * -La carga del último minuto promedia los segundos medidos.
+ */
+
+/* === Macros definitions ========================================================================================== */
+
+#define TICKS_PER_SECOND 4 //!< Ticks por segundo de las pruebas que llaman a LoadTick() directamente
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Cuenta los ticks de un segundo sin dormir
+ */
+static void BusySecond(void);
+
+/**
+ * @brief Función de la hora virtual, las pruebas no imponen entradas
+ *
+ * @param now Hora virtual en microsegundos
+ */
+static void IgnoreClock(uint64_t now);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void BusySecond(void) {
+    for (uint8_t tick = 0; tick < TICKS_PER_SECOND; tick++) {
+        LoadTick();
+    }
+}
+
+static void IgnoreClock(uint64_t now) {
+    (void)now;
+}
+
+/**
+ * @brief Manejador del temporizador del sistema con la hora virtual, cuenta los ticks de la medición
+ */
+void SysTick_Handler(void) {
+    LoadTick();
+}
+
+/**
+ * @brief Setup que se ejecuta antes de cada test
+ */
+void setUp(void) {
+    LoadInit(TICKS_PER_SECOND);
+}
+
+/* === Public function implementation ============================================================================== */
+
+// Un núcleo que nunca duerme tiene la carga completa.
+void test_busy_core_has_full_load(void) {
+    load_stats_t stats;
+
+    BusySecond();
+    LoadGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.seconds);
+    TEST_ASSERT_EQUAL_UINT16(LOAD_FULL, stats.second);
+    TEST_ASSERT_EQUAL_UINT16(LOAD_FULL, stats.minute);
+    TEST_ASSERT_EQUAL_UINT16(LOAD_FULL, stats.peak);
+}
+
+// La carga se calcula una vez por segundo.
+void test_load_is_computed_once_per_second(void) {
+    load_stats_t stats;
+
+    for (uint8_t tick = 1; tick < TICKS_PER_SECOND; tick++) {
+        LoadTick();
+    }
+    LoadGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.seconds);
+    TEST_ASSERT_EQUAL_UINT16(0, stats.second);
+    LoadTick();
+    LoadGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.seconds);
+}
+
+// Borrar la carga máxima la vuelve a medir desde cero y decide si entra en el presupuesto.
+void test_reset_peak_and_budget(void) {
+    BusySecond();
+    TEST_ASSERT_FALSE(LoadWithinBudget(LOAD_BUDGET));
+    LoadResetPeak();
+    TEST_ASSERT_TRUE(LoadWithinBudget(0));
+    BusySecond();
+    TEST_ASSERT_TRUE(LoadWithinBudget(LOAD_FULL));
+    TEST_ASSERT_FALSE(LoadWithinBudget(LOAD_FULL - 1));
+}
+
+// Un núcleo que duerme entre las interrupciones tiene poca carga.
+// Pasa a la hora virtual, que no se puede deshacer, por eso estas pruebas van al final.
+void test_sleeping_core_has_low_load(void) {
+    load_stats_t stats;
+
+    HostClockUseVirtual(IgnoreClock);
+    SysTick_Config(SystemCoreClock / 1000);
+    LoadInit(1000);
+    for (uint16_t wakeup = 0; wakeup < 2000; wakeup++) {
+        LoadSleep();
+    }
+    LoadGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.seconds);
+    TEST_ASSERT_LESS_THAN(LOAD_FULL / 10, stats.peak);
+}
+
+// La carga del último minuto promedia los segundos medidos.
+void test_minute_load_averages_seconds(void) {
+    load_stats_t stats;
+
+    LoadInit(1000);
+    for (uint32_t wakeup = 0; wakeup < 70000; wakeup++) {
+        LoadSleep();
+    }
+    LoadGet(&stats);
+    TEST_ASSERT_EQUAL_UINT32(70, stats.seconds);
+    TEST_ASSERT_LESS_OR_EQUAL(stats.peak, stats.minute);
+    TEST_ASSERT_TRUE(LoadWithinBudget(LOAD_BUDGET));
+}
+
+/* === End of documentation ======================================================================================== */
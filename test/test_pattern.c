@@ -0,0 +1,174 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_pattern.c
+ ** @brief Pruebas unitarias del módulo que reproduce secuencias sobre una salida digital
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "pattern.h"
+#include "digital.h"
+#include "chip.h"
+#include "unity.h"
+
+/**
+ * -Un reproductor recién creado no reproduce nada.
+ * -Un paso encendido activa la salida durante toda su duración.
+ * -El ciclo de trabajo de un paso define los ticks encendida en cada período.
+ * -Una secuencia termina después de sus repeticiones y apaga la salida.
+ * -Una secuencia sin fin vuelve a empezar.
+ * -Al terminar una secuencia continúa la siguiente.
+ * -Detener la reproducción apaga la salida.
+ * -Reproducir una secuencia durante otra empieza la nueva desde su primer paso.
+ */
+
+/* === Macros definitions ========================================================================================== */
+
+#define OUTPUT_GPIO 5 //!< Puerto de la salida usada en las pruebas
+#define OUTPUT_BIT  2 //!< Bit de la salida usada en las pruebas
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Avanza el reproductor y cuenta los ticks en que la salida estuvo encendida
+ *
+ * @param ticks Cantidad de ticks a avanzar
+ * @return uint16_t Ticks con la salida encendida
+ */
+static uint16_t TicksOn(uint16_t ticks);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Pasos de prueba: encendido, apagado y a medio ciclo de trabajo
+static const pattern_step_t STEPS[] = {
+    {20, PATTERN_DUTY_MAX},
+    {10, 0},
+    {20, PATTERN_DUTY_MAX / 2},
+};
+
+//! Secuencia de prueba que se reproduce dos veces
+static const struct pattern_s TWICE = {.steps = STEPS, .length = 3, .repeat = 2};
+
+//! Secuencia de prueba que se repite siempre
+static const struct pattern_s FOREVER = {.steps = STEPS, .length = 1, .repeat = PATTERN_FOREVER};
+
+//! Secuencia de prueba que continúa con otra
+static const struct pattern_s CHAINED = {.steps = &STEPS[1], .length = 1, .repeat = 1, .next = &FOREVER};
+
+static digital_output_t output;
+static pattern_player_t player;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint16_t TicksOn(uint16_t ticks) {
+    uint16_t count = 0;
+
+    for (uint16_t tick = 0; tick < ticks; tick++) {
+        PatternTick(player);
+        if (DigitalOutputGetIsActive(output)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Setup que se ejecuta antes de cada test
+ */
+void setUp(void) {
+    HostGpioReset();
+    output = DigitalOutputCreate(OUTPUT_GPIO, OUTPUT_BIT, false);
+    player = PatternPlayerCreate(output);
+}
+
+/* === Public function implementation ============================================================================== */
+
+// Un reproductor recién creado no reproduce nada.
+void test_new_player_is_stopped(void) {
+    TEST_ASSERT_FALSE(PatternIsPlaying(player));
+    TEST_ASSERT_EQUAL_UINT16(0, TicksOn(100));
+}
+
+// Un paso encendido activa la salida durante toda su duración.
+void test_on_step_keeps_output_active(void) {
+    PatternPlay(player, &TWICE);
+    TEST_ASSERT_EQUAL_UINT16(20, TicksOn(20));
+    TEST_ASSERT_TRUE(LPC_GPIO_PORT->PIN[OUTPUT_GPIO] & (1 << OUTPUT_BIT));
+    TEST_ASSERT_EQUAL_UINT16(0, TicksOn(10));
+}
+
+// El ciclo de trabajo de un paso define los ticks encendida en cada período.
+void test_duty_sets_ticks_on_per_period(void) {
+    PatternPlay(player, &TWICE);
+    TicksOn(30);
+    TEST_ASSERT_EQUAL_UINT16(10, TicksOn(20));
+}
+
+// Una secuencia termina después de sus repeticiones y apaga la salida.
+void test_pattern_stops_after_repeats(void) {
+    PatternPlay(player, &TWICE);
+    TEST_ASSERT_EQUAL_UINT16(2 * (20 + 10), TicksOn(2 * 50));
+    TEST_ASSERT_FALSE(PatternIsPlaying(player));
+    TEST_ASSERT_FALSE(DigitalOutputGetIsActive(output));
+}
+
+// Una secuencia sin fin vuelve a empezar.
+void test_forever_pattern_restarts(void) {
+    PatternPlay(player, &FOREVER);
+    TEST_ASSERT_EQUAL_UINT16(1000, TicksOn(1000));
+    TEST_ASSERT_TRUE(PatternIsPlaying(player));
+}
+
+// Al terminar una secuencia continúa la siguiente.
+void test_pattern_continues_with_next(void) {
+    PatternPlay(player, &CHAINED);
+    TEST_ASSERT_EQUAL_UINT16(0, TicksOn(10));
+    TEST_ASSERT_EQUAL_UINT16(20, TicksOn(20));
+    TEST_ASSERT_TRUE(PatternIsPlaying(player));
+}
+
+// Detener la reproducción apaga la salida.
+void test_stop_turns_output_off(void) {
+    PatternPlay(player, &FOREVER);
+    TicksOn(5);
+    PatternStop(player);
+    TEST_ASSERT_FALSE(PatternIsPlaying(player));
+    TEST_ASSERT_EQUAL_UINT16(0, TicksOn(10));
+}
+
+// Reproducir una secuencia durante otra empieza la nueva desde su primer paso.
+void test_play_during_sequence_starts_from_first_step(void) {
+    PatternPlay(player, &TWICE);
+    TicksOn(45);
+    PatternPlay(player, &CHAINED);
+    TEST_ASSERT_EQUAL_UINT16(0, TicksOn(10));
+    TEST_ASSERT_EQUAL_UINT16(20, TicksOn(20));
+
+    TicksOn(5);
+    PatternPlay(player, &TWICE);
+    TEST_ASSERT_EQUAL_UINT16(20, TicksOn(20));
+    TEST_ASSERT_EQUAL_UINT16(0, TicksOn(10));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,157 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_profile.c
+ ** @brief Pruebas unitarias del módulo que mide el tiempo de ejecución de regiones del código
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "profile.h"
+#include "chip.h"
+#include "unity.h"
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * -Una región acumula la cantidad de ejecuciones y sus duraciones mínima, máxima y promedio.
+ * -Cada duración se cuenta en el intervalo del histograma que le corresponde.
+ * -Las duraciones más largas que el histograma se cuentan en su último intervalo.
+ * -Borrar las estadísticas conserva las regiones en la tabla.
+ * -Con la tabla llena las regiones nuevas no se miden.
+ */
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Busca las estadísticas de una región por su nombre
+ *
+ * @param name Nombre de la región
+ * @param stats Estadísticas de la región
+ * @return true si la región está en la tabla
+ */
+static bool FindStats(const char * name, profile_stats_t * stats);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool FindStats(const char * name, profile_stats_t * stats) {
+    for (uint8_t index = 0; ProfileGetStats(index, stats); index++) {
+        if (strcmp(stats->name, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Setup que se ejecuta antes de cada test
+ */
+void setUp(void) {
+    ProfileReset();
+}
+
+/* === Public function implementation ============================================================================== */
+
+// Una región acumula la cantidad de ejecuciones y sus duraciones mínima, máxima y promedio.
+void test_region_keeps_count_min_max_and_mean(void) {
+    static profile_region_t region;
+    profile_stats_t stats;
+
+    ProfileRecord(&region, "stats", 100);
+    ProfileRecord(&region, "stats", 20);
+    ProfileRecord(&region, "stats", 60);
+
+    TEST_ASSERT_NOT_NULL(region);
+    TEST_ASSERT_TRUE(FindStats("stats", &stats));
+    TEST_ASSERT_EQUAL_UINT32(3, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(20, stats.min);
+    TEST_ASSERT_EQUAL_UINT32(100, stats.max);
+    TEST_ASSERT_EQUAL_UINT32(60, stats.mean);
+}
+
+// Cada duración se cuenta en el intervalo del histograma que le corresponde.
+void test_durations_are_counted_in_their_bucket(void) {
+    static profile_region_t region;
+    profile_stats_t stats;
+
+    ProfileRecord(&region, "histogram", 0);
+    ProfileRecord(&region, "histogram", (1 << PROFILE_BUCKET_SHIFT) - 1);
+    ProfileRecord(&region, "histogram", 1 << PROFILE_BUCKET_SHIFT);
+    ProfileRecord(&region, "histogram", (1 << (PROFILE_BUCKET_SHIFT + 3)) + 1);
+
+    TEST_ASSERT_TRUE(FindStats("histogram", &stats));
+    TEST_ASSERT_EQUAL_UINT32(2, stats.histogram[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.histogram[1]);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.histogram[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.histogram[4]);
+}
+
+// Las duraciones más largas que el histograma se cuentan en su último intervalo.
+void test_long_durations_go_to_last_bucket(void) {
+    static profile_region_t region;
+    profile_stats_t stats;
+
+    ProfileRecord(&region, "overflow", UINT32_MAX);
+
+    TEST_ASSERT_TRUE(FindStats("overflow", &stats));
+    TEST_ASSERT_EQUAL_UINT32(1, stats.histogram[PROFILE_BUCKETS - 1]);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, stats.max);
+}
+
+// Borrar las estadísticas conserva las regiones en la tabla.
+void test_reset_keeps_regions(void) {
+    static profile_region_t region;
+    profile_stats_t stats;
+
+    ProfileRecord(&region, "reset", 50);
+    ProfileReset();
+
+    TEST_ASSERT_TRUE(FindStats("reset", &stats));
+    TEST_ASSERT_EQUAL_UINT32(0, stats.count);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.min);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.max);
+    ProfileRecord(&region, "reset", 30);
+    TEST_ASSERT_TRUE(FindStats("reset", &stats));
+    TEST_ASSERT_EQUAL_UINT32(30, stats.min);
+}
+
+// Con la tabla llena las regiones nuevas no se miden.
+// La tabla no se vacía entre pruebas, por eso esta se ejecuta al final.
+void test_full_table_ignores_new_regions(void) {
+    static profile_region_t regions[PROFILE_REGIONS_MAX];
+    profile_stats_t stats;
+
+    for (uint8_t index = 0; index < PROFILE_REGIONS_MAX; index++) {
+        ProfileRecord(&regions[index], "filler", 10);
+    }
+
+    TEST_ASSERT_NULL(regions[PROFILE_REGIONS_MAX - 1]);
+    TEST_ASSERT_TRUE(ProfileGetStats(PROFILE_REGIONS_MAX - 1, &stats));
+    TEST_ASSERT_FALSE(ProfileGetStats(PROFILE_REGIONS_MAX, &stats));
+}
+
+/* === End of documentation ======================================================================================== */
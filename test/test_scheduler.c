@@ -0,0 +1,200 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_scheduler.c
+ ** @brief Pruebas unitarias del planificador cooperativo de tareas
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "scheduler.h"
+#include "chip.h" /* El planificador usa las secciones críticas de chip.c, así se enlaza con la prueba */
+#include "unity.h"
+#include <string.h>
+
+/**
+ * -Una tarea periódica se activa una vez en cada período.
+ * -La tarea activa de mayor prioridad se ejecuta primero, y entre iguales la primera de la tabla.
+ * -Sin tareas activas se duerme con la función indicada.
+ * -Las señales que llegan antes de ejecutar la tarea se atienden con una sola ejecución.
+ * -Una tarea larga demora a las demás, que registran la demora y los plazos perdidos.
+ */
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+//! Posiciones de las tareas en la tabla de prueba
+enum {
+    TASK_FAST,
+    TASK_SLOW,
+    TASK_EVENT,
+    TASK_LONG,
+    TASKS_COUNT,
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Registra en el orden de ejecución la letra que recibe como contexto
+ */
+static void Record(void * context);
+
+/**
+ * @brief Simula una tarea que tarda tres ticks en terminar
+ */
+static void LongRun(void * context);
+
+/**
+ * @brief Cuenta las veces que el planificador se durmió
+ */
+static void Sleep(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static scheduler_task_t tasks[TASKS_COUNT] = {
+    [TASK_FAST] = {.function = Record, .context = "F", .priority = 1, .period = 1},
+    [TASK_SLOW] = {.function = Record, .context = "S", .priority = 2, .period = 2},
+    [TASK_EVENT] = {.function = Record, .context = "E", .priority = 1},
+    [TASK_LONG] = {.function = LongRun, .context = "L", .priority = 0},
+};
+
+static scheduler_t scheduler;
+
+//! Orden en que se ejecutaron las tareas
+static char trace[32];
+
+static uint16_t sleeps;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void Record(void * context) {
+    strcat(trace, context);
+}
+
+static void LongRun(void * context) {
+    Record(context);
+    for (int tick = 0; tick < 3; tick++) {
+        SchedulerTick(scheduler);
+    }
+}
+
+static void Sleep(void) {
+    sleeps++;
+}
+
+/**
+ * @brief Ejecuta todas las tareas activas
+ */
+static void DispatchAll(void) {
+    while (SchedulerDispatch(scheduler)) {
+    }
+}
+
+/**
+ * @brief Setup que se ejecuta antes de cada test
+ */
+void setUp(void) {
+    scheduler = SchedulerCreate(tasks, TASKS_COUNT, Sleep);
+    trace[0] = '\0';
+    sleeps = 0;
+}
+
+/* === Public function implementation ============================================================================== */
+
+// Una tarea periódica se activa una vez en cada período.
+void test_periodic_tasks_follow_their_period(void) {
+    scheduler_stats_t stats;
+
+    TEST_ASSERT_NOT_NULL(scheduler);
+    for (int tick = 0; tick < 4; tick++) {
+        SchedulerTick(scheduler);
+        DispatchAll();
+    }
+    TEST_ASSERT_EQUAL_STRING("FFSFFS", trace);
+    SchedulerGetStats(scheduler, TASK_SLOW, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.runs);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.misses);
+    TEST_ASSERT_EQUAL_UINT16(0, stats.max_latency);
+}
+
+// La tarea activa de mayor prioridad se ejecuta primero, y entre iguales la primera de la tabla.
+void test_higher_priority_runs_first(void) {
+    SchedulerSignal(scheduler, TASK_EVENT);
+    SchedulerTick(scheduler);
+    SchedulerTick(scheduler);
+    SchedulerSignal(scheduler, TASK_LONG);
+    DispatchAll();
+    TEST_ASSERT_EQUAL_STRING("LFES", trace);
+}
+
+// Sin tareas activas se duerme con la función indicada.
+void test_sleeps_when_nothing_is_ready(void) {
+    TEST_ASSERT_FALSE(SchedulerDispatch(scheduler));
+    TEST_ASSERT_EQUAL_UINT16(1, sleeps);
+    SchedulerSignal(scheduler, TASK_EVENT);
+    TEST_ASSERT_TRUE(SchedulerDispatch(scheduler));
+    TEST_ASSERT_EQUAL_UINT16(1, sleeps);
+    TEST_ASSERT_EQUAL_STRING("E", trace);
+}
+
+// Las señales que llegan antes de ejecutar la tarea se atienden con una sola ejecución.
+void test_signals_are_coalesced(void) {
+    scheduler_stats_t stats;
+
+    SchedulerSignal(scheduler, TASK_EVENT);
+    SchedulerSignal(scheduler, TASK_EVENT);
+    SchedulerSignal(scheduler, TASKS_COUNT);
+    DispatchAll();
+    TEST_ASSERT_EQUAL_STRING("E", trace);
+    SchedulerGetStats(scheduler, TASK_EVENT, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.runs);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.misses);
+}
+
+// Una tarea larga demora a las demás, que registran la demora y los plazos perdidos.
+void test_long_task_delays_others(void) {
+    scheduler_stats_t stats;
+
+    SchedulerTick(scheduler);
+    SchedulerSignal(scheduler, TASK_LONG);
+    DispatchAll();
+    TEST_ASSERT_EQUAL_STRING("LFS", trace);
+
+    /* La rápida se activó en el tick 1 y ejecutó en el 4: perdió las activaciones de los ticks 2, 3 y 4 mientras
+     * esperaba y además terminó fuera de plazo, son cuatro plazos perdidos */
+    SchedulerGetStats(scheduler, TASK_FAST, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.runs);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.misses);
+    TEST_ASSERT_EQUAL_UINT16(3, stats.max_latency);
+
+    /* La lenta se activó en el tick 2 y perdió la del 4, pero terminó justo en su plazo */
+    SchedulerGetStats(scheduler, TASK_SLOW, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.misses);
+    TEST_ASSERT_EQUAL_UINT16(2, stats.max_latency);
+
+    SchedulerGetStats(scheduler, TASK_LONG, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.runs);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.misses);
+}
+
+/* === End of documentation ======================================================================================== */
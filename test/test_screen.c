@@ -0,0 +1,446 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_screen.c
+ ** @brief Pruebas unitarias del módulo de pantalla multiplexada usando la pantalla virtual.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "screen.h"
+#include "chip.h" /* La pantalla usa las secciones críticas de chip.c, así se enlaza con la prueba */
+#include "virtual_screen.h"
+#include "unity.h"
+
+/**
+ * -Al escribir valores BCD se muestran las imágenes de los dígitos.
+ * -Los valores hexadecimales y los códigos especiales tienen imagen propia.
+ * -Un valor fuera de la tabla se muestra apagado.
+ * -Publicar un cuadro con los valores BCD y los puntos juntos.
+ * -Escribir texto ASCII y segmentos crudos.
+ * -Los argumentos nulos y los puntos de dígitos que no existen no cambian lo mostrado.
+ * -Hacer parpadear un grupo de dígitos.
+ * -Desplazar un texto más largo que la pantalla.
+ * -Medir la frecuencia de refresco, el ciclo de trabajo y el costo del barrido.
+ * -Con contenido estático la pantalla barre a la menor frecuencia sin parpadeo.
+ * -El parpadeo de los dígitos eleva la frecuencia de barrido y al terminar vuelve a la anterior.
+ * -Reducir el brillo disminuye el ciclo de trabajo sin producir parpadeo.
+ * -Con otra frecuencia de llamadas la atenuación y el parpadeo barren sin parpadeo.
+ * -Con un temporizador reprogramable el contenido estático se barre a la menor frecuencia sin parpadeo.
+ * -El parpadeo y la atenuación elevan la frecuencia que se pide al temporizador sin cambiar los tiempos.
+ * -Sin nada encendido se detiene el temporizador del barrido.
+ */
+
+/* === Macros definitions ========================================================================================== */
+
+#define SCREEN_DIGITS 4        //!< Cantidad de dígitos de la pantalla de prueba
+#define REFRESH_RATE 1000      //!< Llamadas a ScreenRefresh por segundo, igual al SysTick del reloj
+#define REFRESH_PERIOD_US (1000000 / REFRESH_RATE) //!< Periodo entre llamadas a ScreenRefresh
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Reprograma el temporizador simulado del barrido, registrando la frecuencia pedida por la pantalla
+ *
+ * @param rate Llamadas a ScreenRefresh por segundo, cero para detenerlas
+ */
+static void RecordScanRate(uint16_t rate);
+
+/* === Private variable definitions ================================================================================ */
+
+static screen_t screen;
+
+//! Última frecuencia pedida por la pantalla al temporizador simulado
+static uint16_t requested_rate;
+
+//! Driver de la pantalla virtual con un temporizador de barrido reprogramable
+static struct screen_driver_s timed_driver;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/**
+ * @brief Simula las llamadas a ScreenRefresh desde el SysTick durante un tiempo.
+ *
+ * @param milliseconds Tiempo a simular.
+ */
+static void SimulateMilliseconds(uint32_t milliseconds) {
+    for (uint32_t i = 0; i < milliseconds * REFRESH_RATE / 1000; i++) {
+        VirtualScreenAdvance(REFRESH_PERIOD_US);
+        ScreenRefresh(screen);
+    }
+}
+
+static void RecordScanRate(uint16_t rate) {
+    requested_rate = rate;
+}
+
+/**
+ * @brief Crea una pantalla cuyo driver reprograma el temporizador que llama a ScreenRefresh.
+ */
+static screen_t CreateTimedScreen(void) {
+    screen_t timed;
+
+    timed_driver = *VirtualScreenDriver();
+    timed_driver.ScanRateSet = RecordScanRate;
+    timed = ScreenCreate(SCREEN_DIGITS, &timed_driver);
+    ScreenSetTickRate(timed, REFRESH_RATE);
+    return timed;
+}
+
+/**
+ * @brief Simula las llamadas a ScreenRefresh desde el temporizador, a la última frecuencia que pidió la pantalla.
+ *
+ * @param timed Pantalla creada con CreateTimedScreen().
+ * @param milliseconds Tiempo a simular.
+ */
+static void SimulateTimedMilliseconds(screen_t timed, uint32_t milliseconds) {
+    for (uint32_t i = 0; i < milliseconds * requested_rate / 1000; i++) {
+        VirtualScreenAdvance(1000000 / requested_rate);
+        ScreenRefresh(timed);
+    }
+}
+
+/**
+ * @brief Obtiene la imagen del último cuadro completo.
+ */
+static virtual_frame_t LastFrame(void) {
+    virtual_frame_t frame = {0};
+    TEST_ASSERT_TRUE_MESSAGE(VirtualScreenGetFrame(0, &frame), "No frame was completed.");
+    return frame;
+}
+
+/**
+ * @brief Setup que se ejecuta antes de cada test. Crea una pantalla conectada a la pantalla virtual.
+ */
+void setUp(void) {
+    VirtualScreenInit(SCREEN_DIGITS);
+    screen = ScreenCreate(SCREEN_DIGITS, VirtualScreenDriver());
+    ScreenSetTickRate(screen, REFRESH_RATE);
+}
+
+/* === Public function implementation ============================================================================== */
+
+// Al escribir valores BCD se muestran las imágenes de los dígitos.
+void test_write_bcd_shows_digits(void) {
+    static const uint8_t expected[] = {
+        SEGMENT_B | SEGMENT_C,
+        SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,
+        SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,
+        SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,
+    };
+    uint8_t value[] = {1, 2, 3, 4};
+
+    ScreenWriteBCD(screen, value, sizeof(value));
+    SimulateMilliseconds(50);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, LastFrame().segments, SCREEN_DIGITS);
+}
+
+// Los valores hexadecimales y los códigos especiales tienen imagen propia.
+void test_write_bcd_shows_hex_and_special_glyphs(void) {
+    static const uint8_t expected[] = {
+        SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+        SEGMENT_A | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+        SEGMENT_G,
+        0,
+    };
+    uint8_t value[] = {0xA, 0xF, SCREEN_GLYPH_MINUS, SCREEN_GLYPH_BLANK};
+
+    ScreenWriteBCD(screen, value, sizeof(value));
+    SimulateMilliseconds(50);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, LastFrame().segments, SCREEN_DIGITS);
+}
+
+// Un valor fuera de la tabla se muestra apagado.
+void test_write_bcd_out_of_range_is_blank(void) {
+    uint8_t value[] = {0x20, 0x7F, 0xFF, 8};
+
+    ScreenWriteBCD(screen, value, sizeof(value));
+    SimulateMilliseconds(50);
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, LastFrame().segments, 3);
+    TEST_ASSERT_EQUAL_HEX8(SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+                           LastFrame().segments[3]);
+}
+
+// Publicar un cuadro con los valores BCD y los puntos juntos.
+void test_publish_bcd_with_dots(void) {
+    static const uint8_t expected[] = {
+        SEGMENT_B | SEGMENT_C,
+        SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G | SEGMENT_P,
+        SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,
+        SEGMENT_P,
+    };
+    uint8_t value[] = {1, 2, 3};
+
+    ScreenPublishBCD(screen, value, sizeof(value), (1 << 1) | (1 << 3));
+    SimulateMilliseconds(50);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, LastFrame().segments, SCREEN_DIGITS);
+}
+
+// Escribir texto ASCII.
+void test_write_text(void) {
+    static const uint8_t expected[] = {
+        SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+        SEGMENT_D | SEGMENT_E | SEGMENT_F,
+        0,
+        0,
+    };
+
+    ScreenWriteText(screen, "AL");
+    SimulateMilliseconds(50);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, LastFrame().segments, SCREEN_DIGITS);
+}
+
+// Escribir segmentos crudos.
+void test_write_segments(void) {
+    static const uint8_t segments[] = {SEGMENT_A, SEGMENT_D | SEGMENT_P, SEGMENT_G, SEGMENT_P};
+
+    ScreenWriteSegments(screen, segments, sizeof(segments));
+    SimulateMilliseconds(50);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(segments, LastFrame().segments, SCREEN_DIGITS);
+}
+
+// Los argumentos nulos y los puntos de dígitos que no existen no cambian lo mostrado.
+void test_invalid_arguments_keep_content(void) {
+    static const uint8_t segments[] = {SEGMENT_A, SEGMENT_D | SEGMENT_P, SEGMENT_G, SEGMENT_P};
+
+    ScreenWriteSegments(screen, segments, sizeof(segments));
+    ScreenWriteSegments(screen, NULL, sizeof(segments));
+    ScreenWriteSegments(NULL, segments, sizeof(segments));
+    ScreenWriteText(screen, NULL);
+    ScreenWriteText(NULL, "AL");
+    ScreenStopScroll(NULL);
+    ScreenSetDot(screen, SCREEN_DIGITS, true);
+    ScreenSetDot(NULL, 0, true);
+    ScreenToggleDot(screen, UINT8_MAX);
+    ScreenToggleDot(NULL, 0);
+    ScreenSetTickRate(NULL, REFRESH_RATE);
+    ScreenSetBrightness(NULL, 1);
+    TEST_ASSERT_EQUAL_UINT16(0, ScreenGetScanRate(NULL));
+    TEST_ASSERT_FALSE(ScreenIsScrolling(NULL));
+    SimulateMilliseconds(50);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(segments, LastFrame().segments, SCREEN_DIGITS);
+}
+
+// Hacer parpadear un grupo de dígitos.
+void test_flash_digits(void) {
+    uint8_t value[] = {1, 2, 3, 4};
+
+    ScreenWriteBCD(screen, value, sizeof(value));
+    TEST_ASSERT_EQUAL_INT(0, DisplayFlashDigits(screen, 0, 1, 25));
+
+    SimulateMilliseconds(50);
+    TEST_ASSERT_EQUAL_HEX8(0, LastFrame().segments[0]);
+    TEST_ASSERT_EQUAL_HEX8(0, LastFrame().segments[1]);
+    TEST_ASSERT_NOT_EQUAL(0, LastFrame().segments[2]);
+
+    SimulateMilliseconds(100);
+    TEST_ASSERT_NOT_EQUAL(0, LastFrame().segments[0]);
+    TEST_ASSERT_NOT_EQUAL(0, LastFrame().segments[1]);
+}
+
+// Desplazar un texto más largo que la pantalla.
+void test_scroll_text(void) {
+    virtual_frame_t frame;
+    const uint8_t letter_h = SEGMENT_B | SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G;
+
+    /* Un desplazamiento cada 25 cuadros de 4 ms */
+    TEST_ASSERT_EQUAL_INT(0, ScreenStartScroll(screen, "HOLA-1", 25));
+    TEST_ASSERT_TRUE(ScreenIsScrolling(screen));
+
+    SimulateMilliseconds(150);
+    frame = LastFrame();
+    TEST_ASSERT_EACH_EQUAL_UINT8(0, frame.segments, 3);
+    TEST_ASSERT_EQUAL_HEX8(letter_h, frame.segments[3]);
+
+    SimulateMilliseconds(350);
+    frame = LastFrame();
+    TEST_ASSERT_EQUAL_HEX8(letter_h, frame.segments[0]);
+
+    ScreenStopScroll(screen);
+    TEST_ASSERT_FALSE(ScreenIsScrolling(screen));
+}
+
+// Un texto demasiado largo o un divisor nulo no inician el desplazamiento.
+void test_scroll_rejects_invalid_arguments(void) {
+    TEST_ASSERT_EQUAL_INT(-1, ScreenStartScroll(screen, "HOLA", 0));
+    TEST_ASSERT_EQUAL_INT(-1, ScreenStartScroll(screen, "0123456789012345678901234567890123456789", 1));
+    TEST_ASSERT_FALSE(ScreenIsScrolling(screen));
+}
+
+// Medir la frecuencia de refresco, el ciclo de trabajo y el costo del barrido.
+void test_refresh_rate_duty_and_cost(void) {
+    virtual_screen_stats_t stats;
+    const uint32_t scans = 1000 * ScreenGetScanRate(screen) / REFRESH_RATE;
+
+    SimulateMilliseconds(1000);
+    VirtualScreenGetStats(&stats);
+
+    TEST_ASSERT_UINT32_WITHIN(1, ScreenGetScanRate(screen) / SCREEN_DIGITS, stats.refresh_rate);
+    for (uint8_t digit = 0; digit < SCREEN_DIGITS; digit++) {
+        TEST_ASSERT_UINT32_WITHIN(10, 1000 / SCREEN_DIGITS, stats.duty[digit]);
+    }
+    TEST_ASSERT_FALSE(stats.flicker);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.ghosting);
+    TEST_ASSERT_LESS_OR_EQUAL(3 * scans, stats.calls);
+}
+
+// Con contenido estático la pantalla barre a la menor frecuencia sin parpadeo.
+void test_static_content_uses_lowest_flicker_free_rate(void) {
+    virtual_screen_stats_t stats;
+
+    TEST_ASSERT_LESS_THAN(REFRESH_RATE, ScreenGetScanRate(screen));
+    TEST_ASSERT_GREATER_OR_EQUAL(60 * SCREEN_DIGITS, ScreenGetScanRate(screen));
+
+    SimulateMilliseconds(1000);
+    VirtualScreenGetStats(&stats);
+    TEST_ASSERT_FALSE(stats.flicker);
+}
+
+// El parpadeo de los dígitos eleva la frecuencia de barrido y al terminar vuelve a la anterior.
+void test_flashing_raises_scan_rate(void) {
+    uint16_t idle_rate = ScreenGetScanRate(screen);
+
+    DisplayFlashDigits(screen, 0, 1, 25);
+    TEST_ASSERT_GREATER_THAN(idle_rate, ScreenGetScanRate(screen));
+    TEST_ASSERT_LESS_OR_EQUAL(REFRESH_RATE, ScreenGetScanRate(screen));
+
+    DisplayFlashDigits(screen, 0, 0, 0);
+    TEST_ASSERT_EQUAL_UINT16(idle_rate, ScreenGetScanRate(screen));
+}
+
+// Reducir el brillo disminuye el ciclo de trabajo sin producir parpadeo.
+void test_dimming_reduces_duty_cycle(void) {
+    virtual_screen_stats_t stats;
+
+    ScreenSetBrightness(screen, 1);
+    SimulateMilliseconds(1000);
+    VirtualScreenGetStats(&stats);
+
+    for (uint8_t digit = 0; digit < SCREEN_DIGITS; digit++) {
+        TEST_ASSERT_UINT32_WITHIN(10, 1000 / (SCREEN_DIGITS * SCREEN_BRIGHTNESS_MAX), stats.duty[digit]);
+    }
+    TEST_ASSERT_FALSE(stats.flicker);
+}
+
+// Con otra frecuencia de llamadas la atenuación y el parpadeo barren sin parpadeo.
+void test_dimming_at_other_tick_rate(void) {
+    const uint16_t tick_rate = 2 * REFRESH_RATE;
+    virtual_screen_stats_t stats;
+    uint16_t idle_rate;
+    uint8_t value[] = {1, 2, 3, 4};
+
+    ScreenSetTickRate(screen, tick_rate);
+    idle_rate = ScreenGetScanRate(screen);
+    ScreenWriteBCD(screen, value, sizeof(value));
+    ScreenSetBrightness(screen, 1);
+    DisplayFlashDigits(screen, 0, 1, 25);
+    TEST_ASSERT_GREATER_THAN(idle_rate, ScreenGetScanRate(screen));
+    TEST_ASSERT_LESS_THAN(tick_rate, ScreenGetScanRate(screen));
+
+    for (uint32_t i = 0; i < tick_rate; i++) {
+        VirtualScreenAdvance(1000000 / tick_rate);
+        ScreenRefresh(screen);
+    }
+    VirtualScreenGetStats(&stats);
+    TEST_ASSERT_UINT32_WITHIN(10, 1000 / (SCREEN_DIGITS * SCREEN_BRIGHTNESS_MAX), stats.duty[2]);
+    TEST_ASSERT_FALSE(stats.flicker);
+    TEST_ASSERT_NOT_EQUAL(0, LastFrame().segments[2]);
+}
+
+// Con un temporizador reprogramable el contenido estático se barre a la menor frecuencia sin parpadeo.
+void test_timed_static_content_uses_lowest_flicker_free_rate(void) {
+    screen_t timed = CreateTimedScreen();
+    virtual_screen_stats_t stats;
+    uint8_t value[] = {1, 2, 3, 4};
+
+    ScreenWriteBCD(timed, value, sizeof(value));
+    TEST_ASSERT_EQUAL_UINT16(requested_rate, ScreenGetRefreshRate(timed));
+    TEST_ASSERT_LESS_THAN(REFRESH_RATE, requested_rate);
+    TEST_ASSERT_GREATER_OR_EQUAL(60 * SCREEN_DIGITS, requested_rate);
+
+    /* Cada llamada barre un dígito, ya no hay llamadas que no hacen nada */
+    VirtualScreenInit(SCREEN_DIGITS);
+    SimulateTimedMilliseconds(timed, 1000);
+    VirtualScreenGetStats(&stats);
+    TEST_ASSERT_UINT32_WITHIN(1, requested_rate / SCREEN_DIGITS, stats.refresh_rate);
+    for (uint8_t digit = 0; digit < SCREEN_DIGITS; digit++) {
+        TEST_ASSERT_UINT32_WITHIN(10, 1000 / SCREEN_DIGITS, stats.duty[digit]);
+    }
+    TEST_ASSERT_FALSE(stats.flicker);
+    TEST_ASSERT_EQUAL_UINT32(3 * requested_rate, stats.calls);
+}
+
+// El parpadeo y la atenuación elevan la frecuencia que se pide al temporizador sin cambiar los tiempos.
+void test_timed_flashing_and_dimming_raise_rate(void) {
+    screen_t timed = CreateTimedScreen();
+    virtual_screen_stats_t stats;
+    uint8_t value[] = {1, 2, 3, 4};
+    uint16_t static_rate;
+    uint16_t flashing_rate;
+
+    ScreenWriteBCD(timed, value, sizeof(value));
+    static_rate = requested_rate;
+
+    /* El medio período del parpadeo sigue siendo de 25 cuadros base de 4 ms */
+    DisplayFlashDigits(timed, 0, 1, 25);
+    flashing_rate = requested_rate;
+    TEST_ASSERT_GREATER_THAN(static_rate, flashing_rate);
+    SimulateTimedMilliseconds(timed, 50);
+    TEST_ASSERT_EQUAL_HEX8(0, LastFrame().segments[0]);
+    SimulateTimedMilliseconds(timed, 100);
+    TEST_ASSERT_NOT_EQUAL(0, LastFrame().segments[0]);
+
+    ScreenSetBrightness(timed, 1);
+    TEST_ASSERT_GREATER_THAN(flashing_rate, requested_rate);
+    TEST_ASSERT_LESS_OR_EQUAL(REFRESH_RATE, requested_rate);
+
+    VirtualScreenInit(SCREEN_DIGITS);
+    SimulateTimedMilliseconds(timed, 1000);
+    VirtualScreenGetStats(&stats);
+    TEST_ASSERT_UINT32_WITHIN(10, 1000 / (SCREEN_DIGITS * SCREEN_BRIGHTNESS_MAX), stats.duty[2]);
+    TEST_ASSERT_FALSE(stats.flicker);
+
+    DisplayFlashDigits(timed, 0, 0, 0);
+    ScreenSetBrightness(timed, SCREEN_BRIGHTNESS_MAX);
+    TEST_ASSERT_EQUAL_UINT16(static_rate, requested_rate);
+}
+
+// Sin nada encendido se detiene el temporizador del barrido.
+void test_timed_blank_screen_stops_scan(void) {
+    screen_t timed = CreateTimedScreen();
+    uint8_t value[] = {1, 2, 3, 4};
+
+    TEST_ASSERT_EQUAL_UINT16(0, requested_rate);
+    TEST_ASSERT_EQUAL_UINT16(0, ScreenGetScanRate(timed));
+
+    ScreenWriteBCD(timed, value, sizeof(value));
+    TEST_ASSERT_NOT_EQUAL(0, requested_rate);
+
+    ScreenWriteText(timed, "    ");
+    TEST_ASSERT_EQUAL_UINT16(0, requested_rate);
+
+    TEST_ASSERT_EQUAL_INT(0, ScreenStartScroll(timed, "HOLA", 25));
+    TEST_ASSERT_NOT_EQUAL(0, requested_rate);
+}
+
+/* === End of documentation ======================================================================================== */
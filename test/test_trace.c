@@ -0,0 +1,173 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Lucas Ahumada Checa Casquero <lucasahum@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_trace.c
+ ** @brief Pruebas unitarias del registro binario de eventos
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "trace.h"
+#include "chip.h"
+#include "unity.h"
+
+/**
+ * -Al iniciar el anillo está vacío y la cabecera describe el formato.
+ * -Los eventos se guardan en orden con su dato.
+ * -Al iniciar no se registran las interrupciones, se agregan eligiendo los eventos.
+ * -Al llenarse el anillo se reemplazan los registros más antiguos.
+ * -El tiempo entre registros se guarda en unidades de ciclos del núcleo.
+ * -Un tiempo que no entra en un registro se completa con uno de pausa.
+ */
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Función de la hora virtual, las pruebas no imponen entradas
+ *
+ * @param now Hora virtual en microsegundos
+ */
+static void IgnoreClock(uint64_t now);
+
+/**
+ * @brief Unidades de tiempo del registro que hay en un período
+ *
+ * @param microseconds Período en microsegundos
+ * @return uint32_t Unidades de 2^TRACE_TIME_SHIFT ciclos
+ */
+static uint32_t Units(uint32_t microseconds);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void IgnoreClock(uint64_t now) {
+    (void)now;
+}
+
+static uint32_t Units(uint32_t microseconds) {
+    return (uint32_t)(((uint64_t)microseconds * (SystemCoreClock / 1000000)) >> TRACE_TIME_SHIFT);
+}
+
+/**
+ * @brief Setup que se ejecuta antes de cada test
+ */
+void setUp(void) {
+    TraceInit();
+    TraceSetMask(UINT32_MAX);
+}
+
+/* === Public function implementation ============================================================================== */
+
+// Al iniciar el anillo está vacío y la cabecera describe el formato.
+void test_init_describes_format(void) {
+    const trace_buffer_t * trace = TraceGetBuffer();
+
+    TEST_ASSERT_EQUAL_HEX32(TRACE_MAGIC, trace->magic);
+    TEST_ASSERT_EQUAL_UINT32(SystemCoreClock, trace->clock);
+    TEST_ASSERT_EQUAL_UINT16(TRACE_TIME_SHIFT, trace->shift);
+    TEST_ASSERT_EQUAL_UINT16(TRACE_RECORDS, trace->capacity);
+    TEST_ASSERT_EQUAL_UINT32(0, trace->written);
+    TEST_ASSERT_EQUAL_UINT32(4, sizeof(trace_record_t));
+}
+
+// Los eventos se guardan en orden con su dato.
+void test_events_are_recorded_in_order(void) {
+    const trace_buffer_t * trace = TraceGetBuffer();
+
+    TraceRecord(TRACE_ISR_ENTER, TRACE_ISR_TICK);
+    TraceRecord(TRACE_STATE, 3);
+    TraceRecord(TRACE_ISR_EXIT, TRACE_ISR_TICK);
+    TEST_ASSERT_EQUAL_UINT32(3, trace->written);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_ISR_ENTER, trace->records[0].event);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_ISR_TICK, trace->records[0].payload);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_STATE, trace->records[1].event);
+    TEST_ASSERT_EQUAL_UINT8(3, trace->records[1].payload);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_ISR_EXIT, trace->records[2].event);
+}
+
+// Al iniciar no se registran las interrupciones, se agregan eligiendo los eventos.
+void test_isr_events_are_masked_by_default(void) {
+    const trace_buffer_t * trace = TraceGetBuffer();
+
+    TraceInit();
+    TraceRecord(TRACE_ISR_ENTER, TRACE_ISR_TICK);
+    TraceRecord(TRACE_ALARM_FIRE, 0);
+    TraceSetMask(1UL << TRACE_ISR_ENTER);
+    TraceRecord(TRACE_ISR_ENTER, TRACE_ISR_SCAN);
+    TraceRecord(TRACE_ALARM_SNOOZE, 0);
+    TEST_ASSERT_EQUAL_UINT32(2, trace->written);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_ALARM_FIRE, trace->records[0].event);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_ISR_ENTER, trace->records[1].event);
+}
+
+// Al llenarse el anillo se reemplazan los registros más antiguos.
+void test_full_ring_overwrites_oldest(void) {
+    const trace_buffer_t * trace = TraceGetBuffer();
+
+    for (uint16_t index = 0; index < TRACE_RECORDS + 2; index++) {
+        TraceRecord(TRACE_STATE, (uint8_t)index);
+    }
+    TEST_ASSERT_EQUAL_UINT32(TRACE_RECORDS + 2, trace->written);
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)TRACE_RECORDS, trace->records[0].payload);
+    TEST_ASSERT_EQUAL_UINT8((uint8_t)(TRACE_RECORDS + 1), trace->records[1].payload);
+    TEST_ASSERT_EQUAL_UINT8(2, trace->records[2].payload);
+}
+
+// El tiempo entre registros se guarda en unidades de ciclos del núcleo.
+// Pasa a la hora virtual, que no se puede deshacer, por eso estas pruebas van al final.
+void test_delta_counts_core_cycles(void) {
+    const trace_buffer_t * trace = TraceGetBuffer();
+
+    HostClockUseVirtual(IgnoreClock);
+    SysTick_Config(SystemCoreClock / 1000);
+    TraceInit();
+    TraceSetMask(UINT32_MAX);
+    TraceRecord(TRACE_ISR_ENTER, TRACE_ISR_SCAN);
+    __WFI();
+    TraceRecord(TRACE_ISR_EXIT, TRACE_ISR_SCAN);
+    TEST_ASSERT_EQUAL_UINT32(2, trace->written);
+    TEST_ASSERT_UINT32_WITHIN(Units(100), Units(1000), trace->records[1].delta);
+}
+
+// Un tiempo que no entra en un registro se completa con uno de pausa.
+void test_long_delta_adds_gap(void) {
+    const trace_buffer_t * trace = TraceGetBuffer();
+    uint32_t delta;
+
+    TraceRecord(TRACE_ISR_ENTER, TRACE_ISR_SCAN);
+    for (uint8_t wakeup = 0; wakeup < 50; wakeup++) {
+        __WFI();
+    }
+    TraceRecord(TRACE_ISR_EXIT, TRACE_ISR_SCAN);
+    TEST_ASSERT_EQUAL_UINT32(3, trace->written);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_GAP, trace->records[1].event);
+    TEST_ASSERT_EQUAL_UINT8(TRACE_ISR_EXIT, trace->records[2].event);
+    delta = ((uint32_t)trace->records[1].delta << 16) + trace->records[2].delta;
+    TEST_ASSERT_UINT32_WITHIN(Units(1000), Units(50000), delta);
+}
+
+/* === End of documentation ======================================================================================== */